@@ -0,0 +1,117 @@
+/*
+ * Rearrange Array Elements by Sign - Parallel (Stable Partition + Interleave)
+ *
+ * Problem: Same as optimal.cpp — equal numbers of positive and negative
+ * values, output alternates positive, negative, positive, ... and each sign
+ * keeps its original order.
+ *
+ * Approach:
+ * - optimal.cpp's single pass is really two things: a stable partition by
+ *   sign, then an interleave (k-th positive -> index 2k, k-th negative -> 2k+1).
+ * - STEP 1: parallelStablePartitionCopy (utility_files/ParallelPartition.h)
+ *   puts all positives (in order) in the front half of a buffer and all
+ *   negatives (in order) in the back half.
+ * - STEP 2: interleave in parallel: thread t handles pairs [lo, hi) and
+ *   writes ans[2k] = pos[k], ans[2k+1] = neg[k].
+ *
+ * Complexity:
+ * - Time: O(n / T) per thread
+ * - Space: O(n) for the partition buffer (the answer array is O(n) anyway),
+ *   taken from ScratchArena so it is not re-allocated on every call
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "../../utility_files/ParallelPartition.h"
+using namespace std;
+
+struct NonNegative
+{
+    bool operator()(int x) const { return x >= 0; } // matches optimal.cpp: 0 counts as positive
+};
+
+void rearrangeBySignParallel(const int arr[], size_t n, int ans[], unsigned threads)
+{
+    // Partition buffer from the scratch arena: repeated calls reuse the same pages
+    ScratchScope scratch;
+    int *grouped = scratch.alloc<int>(n);
+    size_t positives = parallelStablePartitionCopy(arr, n, grouped, NonNegative(), threads);
+
+    const int *pos = grouped;
+    const int *neg = grouped + positives;
+    forEachChunk(positives, threads, [&](unsigned, size_t lo, size_t hi)
+                 {
+        for (size_t k = lo; k < hi; k++)
+        {
+            ans[2 * k] = pos[k];
+            ans[2 * k + 1] = neg[k];
+        } });
+}
+
+// Serial reference from optimal.cpp
+void rearrangeBySignSerial(const int arr[], size_t n, int ans[])
+{
+    size_t posIndex = 0, negIndex = 1;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (arr[i] >= 0)
+        {
+            ans[posIndex] = arr[i];
+            posIndex += 2;
+        }
+        else
+        {
+            ans[negIndex] = arr[i];
+            negIndex += 2;
+        }
+    }
+}
+
+int main()
+{
+    // Sample input (same as optimal.cpp)
+    int arr[] = {3, 1, -2, -5, -2, 4};
+    size_t n = sizeof(arr) / sizeof(arr[0]);
+    vector<int> ans(n);
+
+    rearrangeBySignParallel(arr, n, ans.data(), 2);
+    cout << "Rearranged Array Elements: ";
+    for (size_t i = 0; i < n; i++)
+        cout << ans[i] << " ";
+    cout << endl;
+
+    // Scaling benchmark: 2^26 elements, half positive, half negative, shuffled
+    const size_t N = 1 << 26;
+    vector<int> input(N);
+    for (size_t i = 0; i < N; i++)
+        input[i] = (i % 2 == 0) ? (int)(i % 1000) + 1 : -(int)(i % 1000) - 1;
+    shuffle(input.begin(), input.end(), mt19937(8));
+
+    vector<int> expected(N), out(N);
+    auto s0 = chrono::high_resolution_clock::now();
+    rearrangeBySignSerial(input.data(), N, expected.data());
+    auto s1 = chrono::high_resolution_clock::now();
+    cout << "serial (optimal.cpp): " << chrono::duration<double, milli>(s1 - s0).count() << " ms" << endl;
+
+    unsigned maxThreads = max(1u, thread::hardware_concurrency());
+    vector<unsigned> counts;
+    for (unsigned t = 1; t < maxThreads; t *= 2)
+        counts.push_back(t);
+    counts.push_back(maxThreads);
+
+    rearrangeBySignParallel(input.data(), N, out.data(), 1); // warm-up: grows the arena once
+
+    for (unsigned t : counts)
+    {
+        auto t0 = chrono::high_resolution_clock::now();
+        rearrangeBySignParallel(input.data(), N, out.data(), t);
+        auto t1 = chrono::high_resolution_clock::now();
+        cout << t << " thread(s): " << chrono::duration<double, milli>(t1 - t0).count() << " ms"
+             << (out == expected ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
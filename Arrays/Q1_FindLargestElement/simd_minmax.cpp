@@ -0,0 +1,187 @@
+/*
+ * Find Largest Element - Fused Min/Max/ArgMin/ArgMax (Single SIMD Pass)
+ *
+ * Problem: Given an array, report the largest AND smallest element together
+ * with the index where each first occurs, touching memory only once.
+ *
+ * Approach (Per-lane tracking):
+ * - Split the array into 8 lanes (one AVX2 register of 32-bit ints).
+ * - Each lane keeps its own running min/max values and the index where they
+ *   were seen. A strict compare (`>` for max, `<` for min) means a lane only
+ *   moves its index forward on a real improvement, so it keeps the FIRST hit.
+ * - After the vector loop, fold the 8 lanes into one answer (on ties prefer
+ *   the smaller index) and finish the leftover n % 8 elements in scalar code.
+ * - Without AVX2 the same function falls back to a fused scalar loop.
+ *
+ * Notes:
+ * - Indices are tracked as 32-bit lanes, so the SIMD path is limited to
+ *   arrays shorter than 2^31 elements; larger inputs use the scalar loop.
+ * - Requires n > 0 (same as optimal.cpp reading arr[0]).
+ * - Compile with: g++ -O2 -march=native simd_minmax.cpp
+ *
+ * Complexity:
+ * - Time: O(n) single pass (n / 8 vector steps)
+ * - Space: O(1)
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <climits>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+using namespace std;
+
+// Result of the fused scan: both extremes and where they first occur
+struct MinMaxResult
+{
+    int minValue;
+    int maxValue;
+    size_t minIndex;
+    size_t maxIndex;
+};
+
+// Plain fused loop: one pass, four trackers
+MinMaxResult minMaxScalar(const int arr[], size_t n)
+{
+    MinMaxResult r = {arr[0], arr[0], 0, 0};
+    for (size_t i = 1; i < n; i++)
+    {
+        if (arr[i] < r.minValue)
+        {
+            r.minValue = arr[i];
+            r.minIndex = i;
+        }
+        if (arr[i] > r.maxValue)
+        {
+            r.maxValue = arr[i];
+            r.maxIndex = i;
+        }
+    }
+    return r;
+}
+
+MinMaxResult minMaxFused(const int arr[], size_t n)
+{
+#ifdef __AVX2__
+    if (n < 16 || n > (size_t)INT_MAX)
+        return minMaxScalar(arr, n);
+
+    // Seed every lane with the first 8 elements and their own indices
+    __m256i idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i step = _mm256_set1_epi32(8);
+    __m256i first = _mm256_loadu_si256((const __m256i *)arr);
+    __m256i vMin = first, vMax = first;
+    __m256i iMin = idx, iMax = idx;
+
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8)
+    {
+        idx = _mm256_add_epi32(idx, step);
+        __m256i v = _mm256_loadu_si256((const __m256i *)(arr + i));
+
+        // Lanes that strictly improved take the new value and index
+        __m256i gt = _mm256_cmpgt_epi32(v, vMax);
+        __m256i lt = _mm256_cmpgt_epi32(vMin, v);
+        vMax = _mm256_blendv_epi8(vMax, v, gt);
+        iMax = _mm256_blendv_epi8(iMax, idx, gt);
+        vMin = _mm256_blendv_epi8(vMin, v, lt);
+        iMin = _mm256_blendv_epi8(iMin, idx, lt);
+    }
+
+    // Fold the 8 lanes; on equal values keep the earliest index
+    int lMin[8], lMax[8], liMin[8], liMax[8];
+    _mm256_storeu_si256((__m256i *)lMin, vMin);
+    _mm256_storeu_si256((__m256i *)lMax, vMax);
+    _mm256_storeu_si256((__m256i *)liMin, iMin);
+    _mm256_storeu_si256((__m256i *)liMax, iMax);
+
+    MinMaxResult r = {lMin[0], lMax[0], (size_t)liMin[0], (size_t)liMax[0]};
+    for (int k = 1; k < 8; k++)
+    {
+        if (lMin[k] < r.minValue || (lMin[k] == r.minValue && (size_t)liMin[k] < r.minIndex))
+        {
+            r.minValue = lMin[k];
+            r.minIndex = liMin[k];
+        }
+        if (lMax[k] > r.maxValue || (lMax[k] == r.maxValue && (size_t)liMax[k] < r.maxIndex))
+        {
+            r.maxValue = lMax[k];
+            r.maxIndex = liMax[k];
+        }
+    }
+
+    // Scalar tail: indices here are larger than any lane index, so strict compare is enough
+    for (; i < n; i++)
+    {
+        if (arr[i] < r.minValue)
+        {
+            r.minValue = arr[i];
+            r.minIndex = i;
+        }
+        if (arr[i] > r.maxValue)
+        {
+            r.maxValue = arr[i];
+            r.maxIndex = i;
+        }
+    }
+    return r;
+#else
+    return minMaxScalar(arr, n);
+#endif
+}
+
+// What we used to write around optimal.cpp: separate scans for max, min, and each index
+MinMaxResult minMaxSeparateScans(const int arr[], size_t n)
+{
+    MinMaxResult r = {arr[0], arr[0], 0, 0};
+    for (size_t i = 0; i < n; i++)
+        if (arr[i] > r.maxValue)
+            r.maxValue = arr[i];
+    for (size_t i = 0; i < n; i++)
+        if (arr[i] < r.minValue)
+            r.minValue = arr[i];
+    while (arr[r.maxIndex] != r.maxValue)
+        r.maxIndex++;
+    while (arr[r.minIndex] != r.minValue)
+        r.minIndex++;
+    return r;
+}
+
+int main()
+{
+    // Small example (same shape as optimal.cpp)
+    int arr[] = {1, 2, 22, 40, 4, 0, 40, -3, 7, 9, 11, -3, 5, 6, 8, 12, 3, 2};
+    size_t n = sizeof(arr) / sizeof(arr[0]);
+
+    MinMaxResult r = minMaxFused(arr, n);
+    cout << "Largest element: " << r.maxValue << " at index " << r.maxIndex << endl;
+    cout << "Smallest element: " << r.minValue << " at index " << r.minIndex << endl;
+
+    // Benchmark on a large random array
+    const size_t N = 50000000;
+    vector<int> big(N);
+    mt19937 rng(42);
+    for (size_t i = 0; i < N; i++)
+        big[i] = (int)rng();
+
+    auto bench = [&](const char *name, MinMaxResult (*fn)(const int *, size_t))
+    {
+        auto t0 = chrono::high_resolution_clock::now();
+        MinMaxResult res = fn(big.data(), N);
+        auto t1 = chrono::high_resolution_clock::now();
+        double sec = chrono::duration<double>(t1 - t0).count();
+        cout << name << ": max " << res.maxValue << " @" << res.maxIndex
+             << ", min " << res.minValue << " @" << res.minIndex
+             << " | " << sec * 1e3 << " ms, "
+             << (N * sizeof(int)) / sec / 1e9 << " GB/s" << endl;
+    };
+
+    bench("Separate scans", minMaxSeparateScans);
+    bench("Fused scalar  ", minMaxScalar);
+    bench("Fused SIMD    ", minMaxFused);
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+/*
+ * Second Largest Element - Streaming Trackers (Unbounded Input)
+ *
+ * Problem: Values arrive one at a time from a stream that never fits in
+ * memory. At any moment we want the largest and second largest DISTINCT
+ * value seen so far (and, more generally, the top K distinct values).
+ *
+ * Approach:
+ * - SecondLargestTracker: the two-variable update of optimal.cpp, wrapped in
+ *   a push() method. A `found` counter replaces the -1 sentinel so negative
+ *   values work too. Memory is constant.
+ * - TopKTracker: keeps at most K distinct values in an ordered set. The
+ *   smallest kept value is cached, so most pushes are rejected with a single
+ *   compare. Memory is bounded by K.
+ * - merge(): both trackers are mergeable. Merging pushes the (at most 2 or K)
+ *   values of the other tracker, so per-shard trackers can run independently
+ *   and be combined at the end in any order.
+ *
+ * Complexity (per push):
+ * - SecondLargestTracker: O(1) time, O(1) memory
+ * - TopKTracker: O(1) for rejected values, O(log K) for accepted ones;
+ *   O(K) memory
+ * - merge: O(1) and O(K log K) respectively
+ */
+
+#include <iostream>
+#include <set>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+using namespace std;
+
+class SecondLargestTracker
+{
+private:
+    int largest = 0;
+    int secondLargest = 0;
+    int found = 0; // how many of the two slots hold real values
+
+public:
+    void push(int x)
+    {
+        if (found == 0)
+        {
+            largest = x;
+            found = 1;
+        }
+        else if (x > largest)
+        {
+            secondLargest = largest; // previous best becomes second best
+            largest = x;
+            found = 2;
+        }
+        else if (x < largest && (found == 1 || x > secondLargest))
+        {
+            secondLargest = x;
+            found = 2;
+        }
+    }
+
+    void merge(const SecondLargestTracker &other)
+    {
+        if (other.found >= 1)
+            push(other.largest);
+        if (other.found == 2)
+            push(other.secondLargest);
+    }
+
+    bool hasLargest() const { return found >= 1; }
+    bool hasSecondLargest() const { return found == 2; }
+    int getLargest() const { return largest; }
+    int getSecondLargest() const { return secondLargest; }
+};
+
+class TopKTracker
+{
+private:
+    size_t k;
+    set<int> kept;    // at most k distinct values
+    int threshold = 0; // smallest kept value, valid when kept.size() == k
+
+public:
+    explicit TopKTracker(size_t k) : k(k) {}
+
+    void push(int x)
+    {
+        // Fast reject: full and not better than the current K-th largest
+        if (kept.size() == k && x <= threshold)
+            return;
+        if (k == 0 || !kept.insert(x).second)
+            return;
+        if (kept.size() > k)
+            kept.erase(kept.begin());
+        if (kept.size() == k)
+            threshold = *kept.begin();
+    }
+
+    void merge(const TopKTracker &other)
+    {
+        for (int x : other.kept)
+            push(x);
+    }
+
+    // Current top values, largest first
+    vector<int> values() const
+    {
+        return vector<int>(kept.rbegin(), kept.rend());
+    }
+};
+
+// Cheap deterministic stream source (xorshift), so the benchmark measures push()
+struct StreamSource
+{
+    uint64_t state;
+    explicit StreamSource(uint64_t seed) : state(seed) {}
+    int next()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return (int)(state >> 32);
+    }
+};
+
+int main()
+{
+    // Small example: same data as optimal.cpp, but fed one value at a time
+    int arr[] = {1, 6, 2, 6, 7, 7};
+    SecondLargestTracker tracker;
+    for (int x : arr)
+        tracker.push(x);
+    cout << "The largest element is: " << tracker.getLargest()
+         << " and Second largest element is: "
+         << (tracker.hasSecondLargest() ? tracker.getSecondLargest() : -1) << endl;
+
+    // Throughput benchmark: 10^9 pushes split across per-shard trackers
+    const uint64_t PUSHES = 1000000000ULL;
+    const size_t K = 100;
+    unsigned shards = max(1u, thread::hardware_concurrency());
+
+    vector<SecondLargestTracker> second(shards);
+    vector<TopKTracker> topk(shards, TopKTracker(K));
+
+    auto run = [&](const char *name, auto body)
+    {
+        vector<thread> pool;
+        uint64_t perShard = PUSHES / shards;
+        auto t0 = chrono::high_resolution_clock::now();
+        for (unsigned s = 0; s < shards; s++)
+            pool.emplace_back([&, s]()
+                              { body(s, perShard + (s == 0 ? PUSHES % shards : 0)); });
+        for (auto &th : pool)
+            th.join();
+        auto t1 = chrono::high_resolution_clock::now();
+        double sec = chrono::duration<double>(t1 - t0).count();
+        cout << name << ": " << PUSHES << " pushes on " << shards << " shard(s) in "
+             << sec << " s (" << PUSHES / sec / 1e6 << " M pushes/s)" << endl;
+    };
+
+    run("Second largest", [&](unsigned s, uint64_t count)
+        {
+            // Push into a thread-local tracker to avoid false sharing between shards
+            StreamSource src(0x9E3779B97F4A7C15ULL + s);
+            SecondLargestTracker local;
+            for (uint64_t i = 0; i < count; i++)
+                local.push(src.next());
+            second[s] = local; });
+
+    run("Top-100       ", [&](unsigned s, uint64_t count)
+        {
+            StreamSource src(0x9E3779B97F4A7C15ULL + s);
+            TopKTracker local(K);
+            for (uint64_t i = 0; i < count; i++)
+                local.push(src.next());
+            topk[s] = local; });
+
+    // Combine shard states
+    for (unsigned s = 1; s < shards; s++)
+    {
+        second[0].merge(second[s]);
+        topk[0].merge(topk[s]);
+    }
+
+    vector<int> best = topk[0].values();
+    cout << "Merged largest: " << second[0].getLargest()
+         << ", second largest: " << second[0].getSecondLargest() << endl;
+    cout << "Merged top-K agrees: "
+         << (best[0] == second[0].getLargest() && best[1] == second[0].getSecondLargest() ? "yes" : "no")
+         << endl;
+
+    return 0;
+}
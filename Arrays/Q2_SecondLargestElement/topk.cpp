@@ -0,0 +1,232 @@
+/*
+ * Second Largest Element - Generalized to Top-K Distinct Values
+ *
+ * Problem: Return the K largest DISTINCT values of an array in descending
+ * order (K = 2 is the second-largest problem). If the array has fewer than K
+ * distinct values, return all of them.
+ *
+ * Strategies (picked by K):
+ * - Tiny K (K <= 8): "register tracking" — the optimal.cpp idea with K slots
+ *   instead of two. Keep a small descending array; a new value is shifted in
+ *   only if it beats the smallest slot and is not already present.
+ * - Medium K (K <= 4096): bounded min-heap of size K. The heap top is the
+ *   current K-th largest; anything not greater is rejected in O(1). A hash set
+ *   of heap members keeps the values distinct.
+ * - Large K: quickselect (`nth_element`) on a copy to pull out the top K'
+ *   elements, then sort + unique that slice. If duplicates left fewer than K
+ *   distinct values, K' is doubled and we retry.
+ * - Parallel mode: each thread runs the chosen strategy on its own chunk, and
+ *   the per-thread answers (at most T*K values) are merged with one more pass.
+ *
+ * Baseline: brute.cpp style full sort + scan from the end.
+ *
+ * Complexity:
+ * - Register tracking: O(n * K) worst case, O(n) on typical data
+ * - Heap: O(n log K) worst case, O(n) when most values are rejected at the top
+ * - Quickselect: O(n) average + O(K log K) for the final sort
+ * - Sort baseline: O(n log n)
+ */
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <unordered_set>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <random>
+#include <chrono>
+using namespace std;
+
+const size_t REGISTER_MAX_K = 8;
+const size_t HEAP_MAX_K = 4096;
+
+// Tiny K: keep `best[0..count)` sorted descending, like largest/secondLargest
+vector<int> topKRegister(const int arr[], size_t n, size_t k)
+{
+    int best[REGISTER_MAX_K];
+    size_t count = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        int x = arr[i];
+
+        // Fast reject: list is full and x does not beat the smallest slot
+        if (count == k && x <= best[k - 1])
+            continue;
+
+        // Find insert position, rejecting values already tracked
+        size_t pos = 0;
+        while (pos < count && best[pos] > x)
+            pos++;
+        if (pos < count && best[pos] == x)
+            continue;
+
+        // Shift smaller entries down one slot (dropping the last if full)
+        size_t last = (count < k) ? count++ : k - 1;
+        for (size_t j = last; j > pos; j--)
+            best[j] = best[j - 1];
+        best[pos] = x;
+    }
+    return vector<int>(best, best + count);
+}
+
+// Medium K: min-heap whose top is the current K-th largest distinct value
+vector<int> topKHeap(const int arr[], size_t n, size_t k)
+{
+    priority_queue<int, vector<int>, greater<int>> heap;
+    unordered_set<int> members;
+    members.reserve(k * 2);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        int x = arr[i];
+        if (heap.size() == k && x <= heap.top())
+            continue;
+        if (members.count(x))
+            continue;
+
+        heap.push(x);
+        members.insert(x);
+        if (heap.size() > k)
+        {
+            members.erase(heap.top());
+            heap.pop();
+        }
+    }
+
+    vector<int> result;
+    result.reserve(heap.size());
+    while (!heap.empty())
+    {
+        result.push_back(heap.top());
+        heap.pop();
+    }
+    reverse(result.begin(), result.end());
+    return result;
+}
+
+// Large K: select the top K' elements, then sort + unique just that slice
+vector<int> topKSelect(const int arr[], size_t n, size_t k)
+{
+    vector<int> work(arr, arr + n);
+    size_t want = k;
+
+    while (true)
+    {
+        size_t take = min(want, n);
+
+        // After nth_element, work[n-take..n) holds the `take` largest elements
+        nth_element(work.begin(), work.begin() + (n - take), work.end());
+        vector<int> slice(work.begin() + (n - take), work.end());
+        sort(slice.begin(), slice.end(), greater<int>());
+        slice.erase(unique(slice.begin(), slice.end()), slice.end());
+
+        // Every distinct value >= the cut is in the slice, so K of them is enough
+        if (slice.size() >= k || take == n)
+        {
+            if (slice.size() > k)
+                slice.resize(k);
+            return slice;
+        }
+        want *= 2;
+    }
+}
+
+vector<int> topK(const int arr[], size_t n, size_t k)
+{
+    if (k == 0 || n == 0)
+        return vector<int>();
+    if (k <= REGISTER_MAX_K)
+        return topKRegister(arr, n, k);
+    if (k <= HEAP_MAX_K)
+        return topKHeap(arr, n, k);
+    return topKSelect(arr, n, k);
+}
+
+// Parallel mode: top-K per chunk, then top-K of the union of chunk answers
+vector<int> topKParallel(const int arr[], size_t n, size_t k, unsigned threads)
+{
+    if (threads <= 1 || n < threads * k)
+        return topK(arr, n, k);
+
+    vector<vector<int>> partial(threads);
+    vector<thread> pool;
+    size_t chunk = (n + threads - 1) / threads;
+
+    for (unsigned t = 0; t < threads; t++)
+    {
+        size_t lo = min(n, t * chunk);
+        size_t hi = min(n, lo + chunk);
+        pool.emplace_back([&, t, lo, hi]()
+                          { partial[t] = topK(arr + lo, hi - lo, k); });
+    }
+    for (auto &th : pool)
+        th.join();
+
+    vector<int> merged;
+    for (auto &p : partial)
+        merged.insert(merged.end(), p.begin(), p.end());
+    return topK(merged.data(), merged.size(), k);
+}
+
+// Baseline from brute.cpp: sort everything, walk distinct values from the end
+vector<int> topKSortBaseline(const int arr[], size_t n, size_t k)
+{
+    vector<int> work(arr, arr + n);
+    sort(work.begin(), work.end());
+
+    vector<int> result;
+    for (size_t i = n; i-- > 0 && result.size() < k;)
+    {
+        if (result.empty() || result.back() != work[i])
+            result.push_back(work[i]);
+    }
+    return result;
+}
+
+int main()
+{
+    // Small example: K = 2 reproduces the second-largest answer of optimal.cpp
+    int arr[] = {1, 6, 2, 6, 7, 7};
+    size_t n = sizeof(arr) / sizeof(arr[0]);
+
+    vector<int> top2 = topK(arr, n, 2);
+    cout << "The largest element is: " << top2[0]
+         << " and Second largest element is: " << (top2.size() > 1 ? top2[1] : -1) << endl;
+
+    // Benchmark: random data with plenty of duplicates
+    const size_t N = 20000000;
+    vector<int> big(N);
+    mt19937 rng(7);
+    for (size_t i = 0; i < N; i++)
+        big[i] = (int)(rng() % (N / 2));
+
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    size_t ks[] = {2, 8, 100, 1000, 4096, 50000, 500000};
+
+    auto timeIt = [](function<vector<int>()> fn, vector<int> &out)
+    {
+        auto t0 = chrono::high_resolution_clock::now();
+        out = fn();
+        auto t1 = chrono::high_resolution_clock::now();
+        return chrono::duration<double, milli>(t1 - t0).count();
+    };
+
+    for (size_t k : ks)
+    {
+        vector<int> a, b, c;
+        double tSort = timeIt([&]()
+                              { return topKSortBaseline(big.data(), N, k); }, a);
+        double tEngine = timeIt([&]()
+                                { return topK(big.data(), N, k); }, b);
+        double tPar = timeIt([&]()
+                             { return topKParallel(big.data(), N, k, threads); }, c);
+
+        cout << "K=" << k << ": sort " << tSort << " ms, engine " << tEngine
+             << " ms, parallel(" << threads << ") " << tPar << " ms"
+             << ((a == b && b == c) ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
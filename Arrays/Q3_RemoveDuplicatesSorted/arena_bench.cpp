@@ -0,0 +1,157 @@
+/*
+ * Remove Duplicates (better.cpp) - Scratch Arena vs. Per-Call Allocation
+ *
+ * Problem: better.cpp (Q3), Q5 brute.cpp and Q6 brute.cpp each need a
+ * temporary array per call. When these kernels run millions of times on small
+ * batches, that is one heap allocation and free per call; this program
+ * measures how much of the runtime that costs.
+ *
+ * What this measures:
+ * - The three temp-buffer kernels, written once against a fresh vector per
+ *   call and once against ScratchArena (utility_files/ScratchArena.h).
+ * - Global operator new/delete are replaced to count heap allocations. The
+ *   arena gets its blocks from ::operator new too, so its growth is counted
+ *   and a steady-state count of 0 is a real measurement.
+ *
+ * Expected result:
+ * - "vector" mode: one allocation per call
+ * - "arena" mode: 0 allocations in steady state (the arena grew once during warm-up)
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <new>
+#include <cstdlib>
+#include "../../utility_files/ScratchArena.h"
+using namespace std;
+
+// ---- Heap allocation counter ----
+static unsigned long long heapAllocations = 0;
+
+void *operator new(size_t bytes)
+{
+    heapAllocations++;
+    if (void *p = malloc(bytes ? bytes : 1))
+        return p;
+    throw bad_alloc();
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+// ---- Kernels (same logic as the original programs) ----
+
+// Q3 better.cpp: copy each run's last element into temp, then back
+size_t dedupeWithTemp(int arr[], size_t n, int temp[])
+{
+    size_t j = 0;
+    for (size_t i = 0; i + 1 < n; i++)
+        if (arr[i] != arr[i + 1])
+            temp[j++] = arr[i];
+    temp[j++] = arr[n - 1];
+    for (size_t i = 0; i < j; i++)
+        arr[i] = temp[i];
+    return j;
+}
+
+// Q5 brute.cpp: buffer the first d elements, shift, append
+void rotateWithTemp(int arr[], size_t n, size_t d, int temp[])
+{
+    for (size_t i = 0; i < d; i++)
+        temp[i] = arr[i];
+    for (size_t i = d; i < n; i++)
+        arr[i - d] = arr[i];
+    for (size_t i = n - d; i < n; i++)
+        arr[i] = temp[i - (n - d)];
+}
+
+// Q6 brute.cpp: non-zeros into temp, pad with zeros, copy back
+void moveZerosWithTemp(int arr[], size_t n, int temp[])
+{
+    size_t index = 0;
+    for (size_t i = 0; i < n; i++)
+        if (arr[i] != 0)
+            temp[index++] = arr[i];
+    while (index < n)
+        temp[index++] = 0;
+    for (size_t i = 0; i < n; i++)
+        arr[i] = temp[i];
+}
+
+// One "batch": run all three kernels, taking temp space from `getTemp`
+template <typename GetTemp>
+long long runBatch(vector<int> &batch, const vector<int> &source, GetTemp getTemp)
+{
+    size_t n = batch.size();
+    long long checksum = 0;
+
+    copy(source.begin(), source.end(), batch.begin());
+    checksum += getTemp(n, [&](int *temp)
+                        { return (long long)dedupeWithTemp(batch.data(), n, temp); });
+
+    copy(source.begin(), source.end(), batch.begin());
+    checksum += getTemp(n / 3, [&](int *temp)
+                        { rotateWithTemp(batch.data(), n, n / 3, temp); return (long long)batch[0]; });
+
+    copy(source.begin(), source.end(), batch.begin());
+    checksum += getTemp(n, [&](int *temp)
+                        { moveZerosWithTemp(batch.data(), n, temp); return (long long)batch[n - 1]; });
+    return checksum;
+}
+
+int main()
+{
+    const size_t BATCH = 64;
+    const size_t CALLS = 2000000;
+    const size_t WARMUP = 1000;
+
+    // Small sorted batch with duplicates and zeros
+    vector<int> source(BATCH), batch(BATCH);
+    mt19937 rng(5);
+    int value = 0;
+    for (size_t i = 0; i < BATCH; i++)
+    {
+        value += rng() % 2;
+        source[i] = value;
+    }
+
+    // Mode 1: fresh vector per call (what a straightforward port of the VLAs does)
+    auto vectorTemp = [](size_t n, auto body)
+    {
+        vector<int> temp(n);
+        return body(temp.data());
+    };
+
+    // Mode 2: scratch arena, released when the scope ends
+    auto arenaTemp = [](size_t n, auto body)
+    {
+        ScratchScope scratch;
+        return body(scratch.alloc<int>(n));
+    };
+
+    auto bench = [&](const char *name, auto getTemp)
+    {
+        long long checksum = 0;
+        for (size_t c = 0; c < WARMUP; c++)
+            checksum += runBatch(batch, source, getTemp);
+
+        unsigned long long before = heapAllocations;
+        auto t0 = chrono::high_resolution_clock::now();
+        for (size_t c = 0; c < CALLS; c++)
+            checksum += runBatch(batch, source, getTemp);
+        auto t1 = chrono::high_resolution_clock::now();
+        unsigned long long allocs = heapAllocations - before;
+
+        double ns = chrono::duration<double, nano>(t1 - t0).count() / CALLS;
+        cout << name << ": " << ns << " ns/batch, steady-state heap allocations: "
+             << allocs << " (checksum " << checksum << ")" << endl;
+    };
+
+    bench("vector per call", vectorTemp);
+    bench("scratch arena  ", arenaTemp);
+
+    cout << "Arena capacity after run: " << ScratchArena::local().capacity() << " bytes" << endl;
+    return 0;
+}
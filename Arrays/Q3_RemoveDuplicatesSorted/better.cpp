@@ -13,6 +13,8 @@
  * Notes:
  * - Requires O(n) extra space for the temp buffer (this is the "better" (simple)
  *   approach; the optimal O(1) extra space solution uses two pointers in-place).
+ * - The temp buffer comes from the thread-local ScratchArena, so repeated calls
+ *   reuse the same memory instead of allocating each time.
  * - Assumes n > 0; handle empty arrays separately if generalizing.
  *
  * Complexity:
@@ -21,6 +23,7 @@
  */
 
 #include <iostream>
+#include "../../utility_files/ScratchArena.h"
 using namespace std;
 
 int main()
@@ -29,8 +32,9 @@ int main()
     int arr[] = {1, 2, 2, 2, 3, 3};
     int n = sizeof(arr) / sizeof(arr[0]);
 
-    // Temporary buffer to collect unique elements in order
-    int temp[n];
+    // Temporary buffer to collect unique elements in order (released at end of scope)
+    ScratchScope scratch;
+    int *temp = scratch.alloc<int>(n);
     int j = 0; // length of the unique sequence we are building
 
     // Copy an element whenever the next element differs
@@ -0,0 +1,276 @@
+/*
+ * Remove Duplicates from a Sorted Array - External Memory (Files Larger Than RAM)
+ *
+ * Problem: The sorted input is a binary file of 32-bit ints that can be tens
+ * of GB, so neither the std::set of brute.cpp nor the temp buffer of
+ * better.cpp (nor even loading the array for optimal.cpp) is an option.
+ * Write the de-duplicated values to an output file using bounded memory.
+ *
+ * Approach (block streaming):
+ * - Read the input in fixed-size blocks with read(). Each block is deduped
+ *   with the optimal.cpp comparison, but against `last`, the final value of
+ *   everything seen so far. Carrying `last` across blocks handles runs that
+ *   straddle a block boundary.
+ * - Unique values go into an output block that is flushed with one large
+ *   sequential write() whenever it fills up (and once at the end).
+ * - Memory use is exactly two blocks regardless of file size.
+ *
+ * Usage:
+ *   ./external <sorted-input.bin> <output.bin>
+ *   ./external               (generates a demo file under /tmp and verifies it)
+ *
+ * Complexity:
+ * - Time: O(n), one sequential read and one sequential write
+ * - Space: O(B) for the two block buffers (B = BLOCK_BYTES)
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+using namespace std;
+
+const size_t BLOCK_BYTES = 8 << 20; // 8 MB per buffer
+
+struct DedupeStats
+{
+    unsigned long long inputCount = 0;
+    unsigned long long uniqueCount = 0;
+};
+
+// write() until everything is written (write may be partial)
+bool writeAll(int fd, const char *data, size_t bytes)
+{
+    while (bytes > 0)
+    {
+        ssize_t w = write(fd, data, bytes);
+        if (w < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += w;
+        bytes -= (size_t)w;
+    }
+    return true;
+}
+
+// Streams sorted ints from inFd to outFd, keeping one copy of each value
+bool dedupeFile(int inFd, int outFd, DedupeStats &stats)
+{
+    const size_t perBlock = BLOCK_BYTES / sizeof(int);
+    vector<int> inBuf(perBlock), outBuf(perBlock);
+    size_t outCount = 0;
+
+    bool haveLast = false;
+    int last = 0;
+    size_t carryBytes = 0; // bytes of a partially read int left from the previous read
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(inFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    while (true)
+    {
+        ssize_t r = read(inFd, (char *)inBuf.data() + carryBytes, BLOCK_BYTES - carryBytes);
+        if (r < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        if (r == 0)
+            break;
+
+        size_t bytes = carryBytes + (size_t)r;
+        size_t count = bytes / sizeof(int);
+        stats.inputCount += count;
+
+        // Two-pointer dedupe, with `last` standing in for the previous block
+        for (size_t j = 0; j < count; j++)
+        {
+            int x = inBuf[j];
+            if (!haveLast || x != last)
+            {
+                outBuf[outCount++] = x;
+                last = x;
+                haveLast = true;
+
+                if (outCount == perBlock)
+                {
+                    if (!writeAll(outFd, (const char *)outBuf.data(), outCount * sizeof(int)))
+                        return false;
+                    stats.uniqueCount += outCount;
+                    outCount = 0;
+                }
+            }
+        }
+
+        // Keep any trailing partial int for the next read
+        carryBytes = bytes - count * sizeof(int);
+        if (carryBytes > 0)
+            memmove(inBuf.data(), (char *)inBuf.data() + count * sizeof(int), carryBytes);
+    }
+
+    stats.uniqueCount += outCount;
+    if (!writeAll(outFd, (const char *)outBuf.data(), outCount * sizeof(int)))
+        return false;
+
+    // A trailing partial int means the input is not an array of ints
+    if (carryBytes != 0)
+    {
+        cerr << "Input size is not a multiple of " << sizeof(int) << " bytes" << endl;
+        errno = EINVAL;
+        return false;
+    }
+    return true;
+}
+
+// Writes a sorted demo file of `count` ints (about half are duplicates)
+bool writeDemoInput(const char *path, size_t count)
+{
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return false;
+
+    vector<int> buf(BLOCK_BYTES / sizeof(int));
+    mt19937 rng(11);
+    int value = 0;
+    size_t written = 0;
+    while (written < count)
+    {
+        size_t chunk = min(buf.size(), count - written);
+        for (size_t i = 0; i < chunk; i++)
+        {
+            buf[i] = value;
+            value += rng() & 1;
+        }
+        if (!writeAll(fd, (const char *)buf.data(), chunk * sizeof(int)))
+        {
+            int err = errno; // keep the write error for the caller's perror
+            close(fd);
+            errno = err;
+            return false;
+        }
+        written += chunk;
+    }
+    return close(fd) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    string inPath, outPath;
+    bool demo = argc < 3;
+
+    if (demo)
+    {
+        // 1 GB demo input; real runs pass their own files
+        inPath = "/tmp/dedupe_demo_in.bin";
+        outPath = "/tmp/dedupe_demo_out.bin";
+        cout << "Generating demo input " << inPath << " ..." << endl;
+        if (!writeDemoInput(inPath.c_str(), (size_t)1 << 28))
+        {
+            perror("demo input");
+            unlink(inPath.c_str());
+            return 1;
+        }
+    }
+    else
+    {
+        inPath = argv[1];
+        outPath = argv[2];
+    }
+
+    int inFd = open(inPath.c_str(), O_RDONLY);
+    if (inFd < 0)
+    {
+        perror(inPath.c_str());
+        return 1;
+    }
+    int outFd = open(outPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (outFd < 0)
+    {
+        perror(outPath.c_str());
+        close(inFd);
+        return 1;
+    }
+
+    DedupeStats stats;
+    auto t0 = chrono::high_resolution_clock::now();
+    bool ok = dedupeFile(inFd, outFd, stats);
+    auto t1 = chrono::high_resolution_clock::now();
+    int err = errno; // close() below may overwrite it
+    if (close(outFd) != 0 && ok)
+    {
+        ok = false; // a delayed write error
+        err = errno;
+    }
+    close(inFd);
+
+    if (!ok)
+    {
+        errno = err;
+        perror("dedupe");
+        if (demo)
+        {
+            unlink(inPath.c_str());
+            unlink(outPath.c_str());
+        }
+        return 1;
+    }
+
+    double sec = chrono::duration<double>(t1 - t0).count();
+    double inMB = stats.inputCount * sizeof(int) / 1e6;
+    cout << "Input elements:  " << stats.inputCount << endl;
+    cout << "Unique elements: " << stats.uniqueCount << endl;
+    cout << "Throughput: " << inMB / sec << " MB/s read, "
+         << stats.uniqueCount * sizeof(int) / 1e6 / sec << " MB/s written ("
+         << sec << " s, buffers " << 2 * BLOCK_BYTES / (1 << 20) << " MB)" << endl;
+
+    if (demo)
+    {
+        // Values in the demo are 0..max with no gaps, so output must be 0,1,2,...
+        int fd = open(outPath.c_str(), O_RDONLY);
+        bool good = fd >= 0;
+        if (!good)
+            perror(outPath.c_str());
+        vector<int> buf(BLOCK_BYTES / sizeof(int));
+        long long expect = 0;
+        size_t carry = 0; // partial int from the previous read, as in dedupeFile
+        ssize_t r = 0;
+        while (good && (r = read(fd, (char *)buf.data() + carry, BLOCK_BYTES - carry)) > 0)
+        {
+            size_t bytes = carry + (size_t)r;
+            size_t count = bytes / sizeof(int);
+            for (size_t i = 0; i < count; i++)
+                if (buf[i] != expect++)
+                    good = false;
+            carry = bytes - count * sizeof(int);
+            if (carry > 0)
+                memmove(buf.data(), (char *)buf.data() + count * sizeof(int), carry);
+        }
+        if (r < 0)
+        {
+            perror(outPath.c_str());
+            good = false;
+        }
+        if (fd >= 0)
+            close(fd);
+        good = good && carry == 0 && (unsigned long long)expect == stats.uniqueCount;
+        cout << "Verification: " << (good ? "ok" : "FAILED") << endl;
+        unlink(inPath.c_str());
+        unlink(outPath.c_str());
+        if (!good)
+            return 1;
+    }
+
+    return 0;
+}
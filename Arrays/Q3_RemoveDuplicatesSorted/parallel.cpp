@@ -0,0 +1,173 @@
+/*
+ * Remove Duplicates from a Sorted Array - Parallel Chunked Dedupe
+ *
+ * Problem: Same as optimal.cpp (keep one copy of each value of a sorted array
+ * and report the unique count), but for multi-GB arrays where one core is
+ * the bottleneck.
+ *
+ * Approach (three phases):
+ * 1) Split the array into T contiguous chunks. Before any thread writes, save
+ *    the value just before each chunk (`boundary[t] = arr[lo - 1]`).
+ * 2) Each thread runs the two-pointer dedupe of optimal.cpp on its own chunk.
+ *    Boundary fix-up: the chunk's first element is dropped if it equals
+ *    `boundary[t]`, because then it continues a run from the previous chunk.
+ *    Each chunk now has `count[t]` unique values at its front.
+ * 3) An exclusive prefix sum over `count[]` gives each chunk's output offset,
+ *    and every thread copies its unique prefix to `out + offset[t]` in parallel.
+ *
+ * In-place mode (out == arr):
+ * - A destination range can overlap the source range of an earlier chunk, so
+ *   the final move runs chunk by chunk from left to right with memmove (the
+ *   destination is never to the right of the source). Phases 1 and 2 stay parallel.
+ *
+ * Complexity:
+ * - Time: O(n / T) per thread + O(T) for the prefix sum
+ * - Space: O(T) extra (plus the output buffer in out-of-place mode)
+ */
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+using namespace std;
+
+// Two-pointer dedupe of arr[0..n); first element is dropped if it equals `before`
+size_t dedupeChunk(int arr[], size_t n, bool hasBefore, int before)
+{
+    size_t start = 0;
+    while (hasBefore && start < n && arr[start] == before)
+        start++;
+    if (start == n)
+        return 0;
+
+    size_t i = 0;
+    arr[0] = arr[start];
+    for (size_t j = start + 1; j < n; j++)
+    {
+        if (arr[j] != arr[i])
+        {
+            i++;
+            arr[i] = arr[j];
+        }
+    }
+    return i + 1;
+}
+
+// Dedupe sorted arr[0..n) into out (may equal arr); returns the unique count
+size_t removeDuplicatesParallel(int arr[], size_t n, int out[], unsigned threads)
+{
+    if (n == 0)
+        return 0;
+    threads = max(1u, min<unsigned>(threads, (unsigned)((n + 4095) / 4096)));
+
+    size_t chunk = (n + threads - 1) / threads;
+    vector<size_t> lo(threads), hi(threads), count(threads), offset(threads);
+    vector<int> boundary(threads);
+
+    // PHASE 1: fix chunk borders and remember each chunk's predecessor value
+    for (unsigned t = 0; t < threads; t++)
+    {
+        lo[t] = min(n, t * chunk);
+        hi[t] = min(n, lo[t] + chunk);
+        if (lo[t] > 0)
+            boundary[t] = arr[lo[t] - 1];
+    }
+
+    // PHASE 2: dedupe every chunk independently
+    vector<thread> pool;
+    for (unsigned t = 0; t < threads; t++)
+    {
+        pool.emplace_back([&, t]()
+                          { count[t] = dedupeChunk(arr + lo[t], hi[t] - lo[t], lo[t] > 0, boundary[t]); });
+    }
+    for (auto &th : pool)
+        th.join();
+    pool.clear();
+
+    // PHASE 3a: exclusive prefix sum over chunk lengths
+    size_t total = 0;
+    for (unsigned t = 0; t < threads; t++)
+    {
+        offset[t] = total;
+        total += count[t];
+    }
+
+    // PHASE 3b: move each chunk's unique prefix into its final slot
+    if (out == arr)
+    {
+        for (unsigned t = 1; t < threads; t++)
+            memmove(out + offset[t], arr + lo[t], count[t] * sizeof(int));
+    }
+    else
+    {
+        for (unsigned t = 0; t < threads; t++)
+        {
+            pool.emplace_back([&, t]()
+                              { memcpy(out + offset[t], arr + lo[t], count[t] * sizeof(int)); });
+        }
+        for (auto &th : pool)
+            th.join();
+    }
+    return total;
+}
+
+// Serial reference: optimal.cpp two-pointer loop
+size_t removeDuplicatesSerial(int arr[], size_t n)
+{
+    return n == 0 ? 0 : dedupeChunk(arr, n, false, 0);
+}
+
+int main()
+{
+    // Small example (same as optimal.cpp), run in place with 2 threads
+    int arr[] = {1, 2, 2, 2, 3, 3};
+    size_t n = sizeof(arr) / sizeof(arr[0]);
+
+    size_t uniqueCount = removeDuplicatesParallel(arr, n, arr, 2);
+    cout << "Unique elements count = " << uniqueCount << endl;
+    cout << "Array after removing duplicates: ";
+    for (size_t k = 0; k < uniqueCount; k++)
+        cout << arr[k] << " ";
+    cout << endl;
+
+    // Scaling benchmark on a large sorted column (~50% duplicates)
+    const size_t N = 1 << 27; // 512 MB of ints
+    vector<int> input(N);
+    mt19937 rng(3);
+    int value = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+        value += rng() & 1;
+        input[i] = value;
+    }
+
+    vector<int> expected = input;
+    size_t expectedCount = removeDuplicatesSerial(expected.data(), N);
+    expected.resize(expectedCount);
+
+    vector<int> work(N), out(N);
+    unsigned maxThreads = max(1u, thread::hardware_concurrency());
+    vector<unsigned> counts;
+    for (unsigned t = 1; t < maxThreads; t *= 2)
+        counts.push_back(t);
+    counts.push_back(maxThreads);
+
+    for (unsigned t : counts)
+    {
+        copy(input.begin(), input.end(), work.begin());
+        auto t0 = chrono::high_resolution_clock::now();
+        size_t count = removeDuplicatesParallel(work.data(), N, out.data(), t);
+        auto t1 = chrono::high_resolution_clock::now();
+        double sec = chrono::duration<double>(t1 - t0).count();
+
+        bool ok = count == expectedCount && equal(expected.begin(), expected.end(), out.begin());
+        cout << t << " thread(s): " << sec * 1e3 << " ms, "
+             << (N * sizeof(int)) / sec / 1e9 << " GB/s"
+             << (ok ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ * Remove Duplicates from a Sorted Array - SIMD Stream Compaction (In-Place)
+ *
+ * Problem: Same contract as optimal.cpp — remove duplicates from a sorted
+ * array in-place, keep the unique values in order at the front, and return
+ * how many there are.
+ *
+ * Idea (compare with predecessor, then compact):
+ * - In a sorted array a value is "new" exactly when it differs from the
+ *   element right before it. With SIMD we test 8 (AVX2) or 16 (AVX-512)
+ *   elements against their predecessors at once and get a bitmask of keepers.
+ * - AVX2 has no compress instruction, so the mask indexes a 256-entry lookup
+ *   table of lane permutations that packs the keepers to the front of the
+ *   register. AVX-512 has a native compress (`vpcompressd`).
+ * - The packed register is stored at the write position and the write pointer
+ *   advances by popcount(mask). Extra lanes written past it are garbage that
+ *   later stores overwrite.
+ *
+ * In-place safety:
+ * - The write pointer never passes the read pointer, and each store ends
+ *   before the next block we read. The predecessor of each block comes from
+ *   the previously loaded register (not from memory), because the last slot
+ *   of the previous block may already hold garbage.
+ *
+ * Complexity:
+ * - Time: O(n), n / 8 or n / 16 vector steps
+ * - Space: O(1) extra (plus a fixed 8 KB permutation table for AVX2)
+ *
+ * Compile with: g++ -O2 -march=native simd.cpp
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#ifdef __AVX2__
+#include <immintrin.h>
+#include "../../utility_files/CompactLUT.h"
+#endif
+using namespace std;
+
+// Scalar reference: the two-pointer loop from optimal.cpp
+size_t removeDuplicatesScalar(int arr[], size_t n)
+{
+    if (n == 0)
+        return 0;
+    size_t i = 0;
+    for (size_t j = 1; j < n; j++)
+    {
+        if (arr[j] != arr[i])
+        {
+            i++;
+            arr[i] = arr[j];
+        }
+    }
+    return i + 1;
+}
+
+#ifdef __AVX2__
+size_t removeDuplicatesAVX2(int arr[], size_t n)
+{
+    if (n < 16)
+        return removeDuplicatesScalar(arr, n);
+
+    const __m256i rotate = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    __m256i prevVec = _mm256_set1_epi32(arr[0]); // lane 7 = predecessor of the next block
+    size_t w = 1;                                // arr[0] is always unique
+    size_t i = 1;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(arr + i));
+
+        // shifted[k] = element before v[k]: rotate right, then take lane 0 from prev block
+        __m256i shifted = _mm256_permutevar8x32_epi32(v, rotate);
+        __m256i prevLast = _mm256_permutevar8x32_epi32(prevVec, _mm256_set1_epi32(7));
+        shifted = _mm256_blend_epi32(shifted, prevLast, 0x01);
+
+        // Keep lanes whose value differs from the predecessor
+        __m256i eq = _mm256_cmpeq_epi32(v, shifted);
+        unsigned keep = (~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(eq))) & 0xFF;
+
+        __m256i perm = _mm256_load_si256((const __m256i *)compactLUT.perm[keep]);
+        _mm256_storeu_si256((__m256i *)(arr + w), _mm256_permutevar8x32_epi32(v, perm));
+        w += __builtin_popcount(keep);
+        prevVec = v;
+    }
+
+    // Scalar tail: compare with the last ORIGINAL value we read, not arr[i-1]
+    int last = _mm256_extract_epi32(prevVec, 7);
+    for (; i < n; i++)
+    {
+        if (arr[i] != last)
+            arr[w++] = arr[i];
+        last = arr[i];
+    }
+    return w;
+}
+#endif
+
+#ifdef __AVX512F__
+size_t removeDuplicatesAVX512(int arr[], size_t n)
+{
+    if (n < 32)
+        return removeDuplicatesScalar(arr, n);
+
+    // Lane 0 takes prev[15], lanes 1..15 take v[0..14]
+    const __m512i predIdx = _mm512_setr_epi32(15, 16, 17, 18, 19, 20, 21, 22,
+                                              23, 24, 25, 26, 27, 28, 29, 30);
+    __m512i prevVec = _mm512_set1_epi32(arr[0]);
+    size_t w = 1;
+    size_t i = 1;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        __m512i v = _mm512_loadu_si512((const void *)(arr + i));
+
+        // Each lane's predecessor: [prev[15], v[0..14]]
+        __m512i shifted = _mm512_permutex2var_epi32(prevVec, predIdx, v);
+        __mmask16 keep = _mm512_cmpneq_epi32_mask(v, shifted);
+
+        // Native compress, then a full-width store (cheaper than compressstoreu on many cores)
+        _mm512_storeu_si512((void *)(arr + w), _mm512_maskz_compress_epi32(keep, v));
+        w += __builtin_popcount(keep);
+        prevVec = v;
+    }
+
+    // Scalar tail: predecessor is the last ORIGINAL value of the final block
+    int lanes[16];
+    _mm512_storeu_si512((void *)lanes, prevVec);
+    int last = lanes[15];
+    for (; i < n; i++)
+    {
+        if (arr[i] != last)
+            arr[w++] = arr[i];
+        last = arr[i];
+    }
+    return w;
+}
+#endif
+
+// Best kernel available for this build
+size_t removeDuplicates(int arr[], size_t n)
+{
+#if defined(__AVX512F__)
+    return removeDuplicatesAVX512(arr, n);
+#elif defined(__AVX2__)
+    return removeDuplicatesAVX2(arr, n);
+#else
+    return removeDuplicatesScalar(arr, n);
+#endif
+}
+
+// Sorted input where roughly `dupRatio` of the elements repeat their predecessor
+vector<int> makeSorted(size_t n, double dupRatio, uint32_t seed)
+{
+    mt19937 rng(seed);
+    bernoulli_distribution isDup(dupRatio);
+    vector<int> v(n);
+    int value = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (i > 0 && !isDup(rng))
+            value++;
+        v[i] = value;
+    }
+    return v;
+}
+
+int main()
+{
+    // Small example (same as optimal.cpp)
+    int arr[] = {1, 2, 2, 2, 3, 3};
+    size_t n = sizeof(arr) / sizeof(arr[0]);
+
+    size_t uniqueCount = removeDuplicates(arr, n);
+    cout << "Unique elements count = " << uniqueCount << endl;
+    cout << "Array after removing duplicates: ";
+    for (size_t k = 0; k < uniqueCount; k++)
+        cout << arr[k] << " ";
+    cout << endl;
+
+    // Throughput across duplicate ratios
+    const size_t N = 1 << 25;
+    double ratios[] = {0.0, 0.1, 0.5, 0.9, 0.99};
+
+    struct Kernel
+    {
+        const char *name;
+        size_t (*fn)(int *, size_t);
+    };
+    vector<Kernel> kernels = {{"scalar ", removeDuplicatesScalar}};
+#ifdef __AVX2__
+    kernels.push_back({"AVX2   ", removeDuplicatesAVX2});
+#endif
+#ifdef __AVX512F__
+    kernels.push_back({"AVX-512", removeDuplicatesAVX512});
+#endif
+
+    for (double ratio : ratios)
+    {
+        vector<int> input = makeSorted(N, ratio, 1);
+        vector<int> expected = input;
+        size_t expectedCount = removeDuplicatesScalar(expected.data(), N);
+
+        for (auto &kernel : kernels)
+        {
+            vector<int> work = input;
+            auto t0 = chrono::high_resolution_clock::now();
+            size_t count = kernel.fn(work.data(), N);
+            auto t1 = chrono::high_resolution_clock::now();
+            double sec = chrono::duration<double>(t1 - t0).count();
+
+            bool ok = count == expectedCount &&
+                      equal(work.begin(), work.begin() + count, expected.begin());
+            cout << "dup ratio " << ratio << " | " << kernel.name << ": "
+                 << (N * sizeof(int)) / sec / 1e9 << " GB/s"
+                 << (ok ? "" : "  [MISMATCH]") << endl;
+        }
+    }
+
+    return 0;
+}
@@ -12,6 +12,8 @@
  * Notes:
  * - We apply D %= n to support D >= n (effective rotation)
  * - Stable rotation: relative order preserved
+ * - The temp buffer is drawn from the thread-local ScratchArena (no heap
+ *   allocation once the arena has warmed up)
  *
  * Complexity:
  * - Time: O(n) with two linear passes and a tail copy
@@ -19,6 +21,7 @@
  */
 
 #include <iostream>
+#include "../../utility_files/ScratchArena.h"
 using namespace std;
 
 int main()
@@ -33,8 +36,9 @@ int main()
     // Normalize D in case it is >= n (no-op when D == 0)
     d = d % n; // Handle case for d >= n
 
-    // Temporary buffer to hold the first D elements
-    int temp[d];
+    // Temporary buffer to hold the first D elements (released at end of scope)
+    ScratchScope scratch;
+    int *temp = scratch.alloc<int>(d);
 
     // STEP 1: Copy the first D elements into temp
     for (int i = 0; i < d; i++)
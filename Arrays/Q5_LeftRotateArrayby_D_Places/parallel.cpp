@@ -0,0 +1,169 @@
+/*
+ * Left Rotate Array by D Places - Multi-Threaded (Multi-GB Arrays)
+ *
+ * Problem: Rotate a very large array left by D. Every Q5 variant so far runs
+ * on one core, so it is limited to single-core memory bandwidth.
+ *
+ * In-place (parallel reversal):
+ * - Same three reversals as optimal.cpp: reverse [0, D), reverse [D, n),
+ *   reverse [0, n).
+ * - Reversing [lo, hi) is len/2 independent swaps: arr[lo + k] <-> arr[hi - 1 - k].
+ *   We split k into T ranges, so thread t swaps a chunk at the front with
+ *   its mirror chunk at the back. No two threads touch the same element.
+ * - The first two reversals touch disjoint ranges, so they run in the same
+ *   parallel phase (threads are shared in proportion to their lengths).
+ *
+ * Out-of-place (when a second buffer is available):
+ * - out[i] = arr[(i + D) % n] is two contiguous copies, arr[D, n) -> out[0, n-D)
+ *   and arr[0, D) -> out[n-D, n). Split the output into T equal ranges; each
+ *   thread copies its range, which is at most two memcpy calls.
+ * - One read + one write per element, versus ~2 of each for the in-place version.
+ *
+ * Complexity:
+ * - Time: O(n / T) per thread
+ * - Space: O(1) extra in-place, O(n) for the out-of-place buffer
+ */
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+using namespace std;
+
+// Swap indices k in [kBegin, kEnd) of the reversal of arr[lo, hi)
+void reverseSwapRange(int arr[], size_t lo, size_t hi, size_t kBegin, size_t kEnd)
+{
+    int *left = arr + lo + kBegin;
+    int *right = arr + hi - 1 - kBegin;
+    for (size_t k = kBegin; k < kEnd; k++)
+        swap(*left++, *right--);
+}
+
+// Reverse several disjoint ranges at once using `threads` workers
+void parallelReverse(int arr[], const vector<pair<size_t, size_t>> &ranges, unsigned threads)
+{
+    size_t totalSwaps = 0;
+    for (auto &r : ranges)
+        totalSwaps += (r.second - r.first) / 2;
+    if (totalSwaps == 0)
+        return;
+    threads = max(1u, threads);
+
+    // Hand out equal slices of the combined swap space [0, totalSwaps)
+    size_t per = (totalSwaps + threads - 1) / threads;
+    vector<thread> pool;
+    for (unsigned t = 0; t < threads; t++)
+    {
+        size_t sBegin = t * per, sEnd = min(totalSwaps, sBegin + per);
+        if (sBegin >= sEnd)
+            break;
+        pool.emplace_back([&, sBegin, sEnd]()
+                          {
+            size_t base = 0;
+            for (auto &r : ranges)
+            {
+                size_t swaps = (r.second - r.first) / 2;
+                size_t from = max(sBegin, base), to = min(sEnd, base + swaps);
+                if (from < to)
+                    reverseSwapRange(arr, r.first, r.second, from - base, to - base);
+                base += swaps;
+            } });
+    }
+    for (auto &th : pool)
+        th.join();
+}
+
+void rotateLeftParallel(int arr[], size_t n, size_t d, unsigned threads)
+{
+    if (n == 0)
+        return;
+    d %= n;
+    if (d == 0)
+        return;
+    parallelReverse(arr, {{0, d}, {d, n}}, threads); // STEPS 1+2 together
+    parallelReverse(arr, {{0, n}}, threads);         // STEP 3
+}
+
+// out must not overlap arr
+void rotateLeftOutOfPlaceParallel(const int arr[], int out[], size_t n, size_t d, unsigned threads)
+{
+    if (n == 0)
+        return;
+    d %= n;
+    threads = max(1u, threads);
+    size_t split = n - d; // out[0, split) comes from arr[d, n), out[split, n) from arr[0, d)
+
+    size_t per = (n + threads - 1) / threads;
+    vector<thread> pool;
+    for (unsigned t = 0; t < threads; t++)
+    {
+        size_t lo = t * per, hi = min(n, lo + per);
+        if (lo >= hi)
+            break;
+        pool.emplace_back([=]()
+                          {
+            if (lo < split)
+            {
+                size_t end = min(hi, split);
+                memcpy(out + lo, arr + d + lo, (end - lo) * sizeof(int));
+            }
+            if (hi > split)
+            {
+                size_t start = max(lo, split);
+                memcpy(out + start, arr + (start - split), (hi - start) * sizeof(int));
+            } });
+    }
+    for (auto &th : pool)
+        th.join();
+}
+
+int main()
+{
+    // Small example (same as optimal.cpp) with 3 threads
+    int arr[] = {1, 2, 3, 4, 5, 6};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    rotateLeftParallel(arr, n, 2, 3);
+
+    cout << "Array after rotation: ";
+    for (int i = 0; i < n; i++)
+        cout << arr[i] << " ";
+    cout << endl;
+
+    // Scaling benchmark: 512 MB array, D chosen so the reversals are uneven
+    const size_t N = 1 << 27;
+    const size_t D = N / 3 + 12345;
+    vector<int> big(N), out(N);
+
+    unsigned maxThreads = max(1u, thread::hardware_concurrency());
+    vector<unsigned> counts;
+    for (unsigned t = 1; t < maxThreads; t *= 2)
+        counts.push_back(t);
+    counts.push_back(maxThreads);
+
+    for (unsigned t : counts)
+    {
+        for (size_t i = 0; i < N; i++)
+            big[i] = (int)i;
+
+        auto t0 = chrono::high_resolution_clock::now();
+        rotateLeftParallel(big.data(), N, D, t);
+        auto t1 = chrono::high_resolution_clock::now();
+        bool okIn = big[0] == (int)D && big[N - 1] == (int)(D - 1) && big[N - D] == 0;
+
+        auto t2 = chrono::high_resolution_clock::now();
+        rotateLeftOutOfPlaceParallel(big.data(), out.data(), N, N - D, t); // rotate back
+        auto t3 = chrono::high_resolution_clock::now();
+        bool okOut = out[0] == 0 && out[N / 2] == (int)(N / 2) && out[N - 1] == (int)(N - 1);
+
+        double gb = N * sizeof(int) / 1e9;
+        cout << t << " thread(s): in-place " << chrono::duration<double, milli>(t1 - t0).count()
+             << " ms (" << gb / chrono::duration<double>(t1 - t0).count() << " GB/s), out-of-place "
+             << chrono::duration<double, milli>(t3 - t2).count() << " ms ("
+             << gb / chrono::duration<double>(t3 - t2).count() << " GB/s)"
+             << (okIn && okOut ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ * Left Rotate Array by D Places - Zero-Copy Rotated View
+ *
+ * Problem: In ring-buffer style workloads the array is rotated many times but
+ * read rarely. brute.cpp and optimal.cpp move all n elements on every
+ * rotation, which is wasted work if nobody looks at the result.
+ *
+ * Idea (rotate the index, not the data):
+ * - A left rotation by D only changes which element is "first". Store the base
+ *   pointer, the length n and an `offset`; element i of the view is
+ *   base[(offset + i) % n].
+ * - rotateLeft(d) / rotateRight(d) just adjust `offset`, so rotation is O(1)
+ *   and any sequence of rotations composes into a single offset.
+ * - The view is always two contiguous pieces, base[offset..n) and
+ *   base[0..offset), which makes bulk copies (materialize) two memcpy calls.
+ * - materializeInPlace() applies the pending rotation with the reversal
+ *   algorithm from optimal.cpp and resets the offset to 0.
+ *
+ * Complexity:
+ * - rotateLeft / rotateRight: O(1)
+ * - Element access: O(1) (one add and one compare, no division)
+ * - materialize: O(n)
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <chrono>
+#include <cstddef>
+using namespace std;
+
+template <typename T>
+class RotatedView
+{
+private:
+    T *base;
+    size_t n;
+    size_t offset; // index in `base` of the view's first element, always < n
+
+    // Physical index for logical index i (i < n), without a modulo
+    size_t physical(size_t i) const
+    {
+        size_t p = offset + i;
+        return p >= n ? p - n : p;
+    }
+
+public:
+    class iterator
+    {
+    private:
+        const RotatedView *view;
+        size_t i;
+
+    public:
+        using iterator_category = random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        iterator() : view(nullptr), i(0) {}
+        iterator(const RotatedView *view, size_t i) : view(view), i(i) {}
+
+        reference operator*() const { return view->base[view->physical(i)]; }
+        pointer operator->() const { return &**this; }
+        reference operator[](difference_type k) const { return *(*this + k); }
+        iterator &operator++() { i++; return *this; }
+        iterator operator++(int) { iterator old = *this; i++; return old; }
+        iterator &operator--() { i--; return *this; }
+        iterator operator--(int) { iterator old = *this; i--; return old; }
+        iterator &operator+=(difference_type k) { i += k; return *this; }
+        iterator &operator-=(difference_type k) { i -= k; return *this; }
+        iterator operator+(difference_type k) const { return iterator(view, i + k); }
+        friend iterator operator+(difference_type k, const iterator &it) { return it + k; }
+        iterator operator-(difference_type k) const { return iterator(view, i - k); }
+        difference_type operator-(const iterator &o) const { return (difference_type)i - (difference_type)o.i; }
+        bool operator==(const iterator &o) const { return i == o.i; }
+        bool operator!=(const iterator &o) const { return i != o.i; }
+        bool operator<(const iterator &o) const { return i < o.i; }
+        bool operator>(const iterator &o) const { return i > o.i; }
+        bool operator<=(const iterator &o) const { return i <= o.i; }
+        bool operator>=(const iterator &o) const { return i >= o.i; }
+    };
+
+    RotatedView(T *base, size_t n) : base(base), n(n), offset(0) {}
+
+    size_t size() const { return n; }
+    T &operator[](size_t i) const { return base[physical(i)]; }
+    T &front() const { return base[offset]; }
+    T &back() const { return base[physical(n - 1)]; }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, n); }
+
+    // O(1): composing rotations only moves the offset
+    void rotateLeft(size_t d)
+    {
+        if (n == 0)
+            return;
+        d %= n;
+        offset = (offset + d) % n;
+    }
+
+    void rotateRight(size_t d)
+    {
+        if (n == 0)
+            return;
+        d %= n;
+        rotateLeft(n - d);
+    }
+
+    // The view as two contiguous pieces: [first, first + firstLen) then [base, base + offset)
+    T *firstPiece() const { return base + offset; }
+    size_t firstPieceLength() const { return n - offset; }
+    T *secondPiece() const { return base; }
+    size_t secondPieceLength() const { return offset; }
+
+    // Copy the rotated sequence out (two bulk copies)
+    void materialize(T out[]) const
+    {
+        T *mid = copy(base + offset, base + n, out);
+        copy(base, base + offset, mid);
+    }
+
+    // Make the underlying array match the view (reversal algorithm), offset becomes 0
+    void materializeInPlace()
+    {
+        reverse(base, base + offset);
+        reverse(base + offset, base + n);
+        reverse(base, base + n);
+        offset = 0;
+    }
+};
+
+int main()
+{
+    // Small example: rotate left by 2 (as in optimal.cpp), then by 3 more, then right by 1
+    int arr[] = {1, 2, 3, 4, 5, 6};
+    int n = sizeof(arr) / sizeof(arr[0]);
+
+    RotatedView<int> view(arr, n);
+    view.rotateLeft(2);
+    cout << "View after [D=2] rotation: ";
+    for (int x : view)
+        cout << x << " ";
+    cout << endl;
+
+    view.rotateLeft(3);
+    view.rotateRight(1);
+    cout << "View after left 3, right 1: ";
+    for (int x : view)
+        cout << x << " ";
+    cout << endl;
+
+    view.materializeInPlace();
+    cout << "Underlying array after materializeInPlace: ";
+    for (int k = 0; k < n; k++)
+        cout << arr[k] << " ";
+    cout << endl;
+
+    // Benchmark: many rotations, one read at the end
+    const size_t N = 1 << 20;
+    const size_t ROTATIONS = 2000;
+    vector<int> physicalArr(N), viewArr(N), out(N);
+    for (size_t i = 0; i < N; i++)
+        physicalArr[i] = viewArr[i] = (int)i;
+
+    auto t0 = chrono::high_resolution_clock::now();
+    for (size_t r = 0; r < ROTATIONS; r++)
+    {
+        size_t d = (r * 7919) % N;
+        reverse(physicalArr.begin(), physicalArr.begin() + d);
+        reverse(physicalArr.begin() + d, physicalArr.end());
+        reverse(physicalArr.begin(), physicalArr.end());
+    }
+    auto t1 = chrono::high_resolution_clock::now();
+
+    RotatedView<int> big(viewArr.data(), N);
+    for (size_t r = 0; r < ROTATIONS; r++)
+        big.rotateLeft((r * 7919) % N);
+    big.materialize(out.data());
+    auto t2 = chrono::high_resolution_clock::now();
+
+    bool same = equal(out.begin(), out.end(), physicalArr.begin());
+    cout << ROTATIONS << " rotations of " << N << " ints: physical "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms, view + one materialize "
+         << chrono::duration<double, milli>(t2 - t1).count() << " ms"
+         << (same ? "" : "  [MISMATCH]") << endl;
+
+    return 0;
+}
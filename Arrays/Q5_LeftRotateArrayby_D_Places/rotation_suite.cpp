@@ -0,0 +1,294 @@
+/*
+ * Left Rotate Array by D Places - Rotation Algorithm Suite + Selector
+ *
+ * Problem: Rotate an array left by D positions. brute.cpp (temp buffer of D)
+ * and optimal.cpp (three reversals) are only two of several classic
+ * algorithms, and which one is fastest depends on D, n and the element size.
+ *
+ * Algorithms:
+ * - Temp buffer (brute.cpp): copy the smaller side out, memmove the rest,
+ *   copy it back. 2 moves per element but needs O(min(D, n-D)) scratch.
+ * - Reversal (optimal.cpp): reverse A, reverse B, reverse AB. ~2 swaps per
+ *   element, O(1) space, sequential access.
+ * - Juggling (GCD cycles): gcd(n, D) cycles, each moving elements D apart.
+ *   Exactly one move per element but strided access, so it is cache-hostile
+ *   for large arrays.
+ * - Block swap (Gries-Mills): swap the shorter side with the matching end of
+ *   the longer side, then continue on the remaining part. ~1 swap per element.
+ * - Trinity (bounded buffer): uses the temp buffer when the short side fits in
+ *   a fixed scratch limit, a "bridge" when the two sides differ by less than
+ *   the limit (only the difference is buffered), and falls back to reversal.
+ *
+ * Selector: picks an algorithm from D, n and sizeof(T). When the short side
+ * (or the bridge) fits the scratch limit it uses trinity; otherwise block swap.
+ * The benchmark matrix printed by main() is what these choices are based on.
+ *
+ * Scratch memory for the buffered variants comes from ScratchArena, capped at
+ * SCRATCH_LIMIT_BYTES.
+ *
+ * Complexity:
+ * - All: O(n) time
+ * - Space: O(1) for reversal/juggling/block swap, bounded O(limit) for trinity,
+ *   O(min(D, n-D)) for the temp buffer
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <chrono>
+#include <cstring>
+#include <type_traits>
+#include "../../utility_files/ScratchArena.h"
+using namespace std;
+
+const size_t SCRATCH_LIMIT_BYTES = 256 * 1024;
+
+template <typename T>
+void rotateTempBuffer(T arr[], size_t n, size_t d)
+{
+    static_assert(is_trivially_copyable<T>::value, "buffered rotation needs memcpy-able T");
+    if (d == 0 || d == n)
+        return;
+    ScratchScope scratch;
+    if (d <= n - d)
+    {
+        T *temp = scratch.alloc<T>(d);
+        memcpy(temp, arr, d * sizeof(T));
+        memmove(arr, arr + d, (n - d) * sizeof(T));
+        memcpy(arr + (n - d), temp, d * sizeof(T));
+    }
+    else
+    {
+        size_t r = n - d;
+        T *temp = scratch.alloc<T>(r);
+        memcpy(temp, arr + d, r * sizeof(T));
+        memmove(arr + r, arr, d * sizeof(T));
+        memcpy(arr, temp, r * sizeof(T));
+    }
+}
+
+template <typename T>
+void rotateReversal(T arr[], size_t n, size_t d)
+{
+    reverse(arr, arr + d);
+    reverse(arr + d, arr + n);
+    reverse(arr, arr + n);
+}
+
+template <typename T>
+void rotateJuggling(T arr[], size_t n, size_t d)
+{
+    if (d == 0 || d == n)
+        return;
+    size_t cycles = gcd(n, d);
+    for (size_t start = 0; start < cycles; start++)
+    {
+        // Walk the cycle start, start+d, start+2d, ... (mod n), pulling each element left by d
+        T saved = arr[start];
+        size_t hole = start;
+        while (true)
+        {
+            size_t next = hole + d;
+            if (next >= n)
+                next -= n;
+            if (next == start)
+                break;
+            arr[hole] = arr[next];
+            hole = next;
+        }
+        arr[hole] = saved;
+    }
+}
+
+template <typename T>
+void rotateBlockSwap(T arr[], size_t n, size_t d)
+{
+    // Invariant: rotate arr[lo .. lo+a+b) where the first block has length a, the second b
+    size_t lo = 0, a = d, b = n - d;
+    while (a != 0 && b != 0)
+    {
+        if (a <= b)
+        {
+            // A B1 B2 with |B2| = a: swap A and B2 -> B2 B1 A, A is final; rotate B2 B1
+            swap_ranges(arr + lo, arr + lo + a, arr + lo + b);
+            b -= a;
+        }
+        else
+        {
+            // A1 A2 B with |A1| = b: swap A1 and B -> B A2 A1, B is final; rotate A2 A1
+            swap_ranges(arr + lo, arr + lo + b, arr + lo + a);
+            lo += b;
+            a -= b;
+        }
+    }
+}
+
+template <typename T>
+void rotateTrinity(T arr[], size_t n, size_t d)
+{
+    static_assert(is_trivially_copyable<T>::value, "buffered rotation needs memcpy-able T");
+    if (d == 0 || d == n)
+        return;
+
+    const size_t limit = SCRATCH_LIMIT_BYTES / sizeof(T);
+    size_t left = d, right = n - d;
+
+    // Short side fits in the buffer: plain temp-buffer rotation
+    if (min(left, right) <= limit)
+    {
+        rotateTempBuffer(arr, n, d);
+        return;
+    }
+
+    // Sides are nearly equal: buffer only the difference ("bridge") and swap the rest in one pass
+    size_t bridge = left < right ? right - left : left - right;
+    if (bridge == 0)
+    {
+        swap_ranges(arr, arr + left, arr + left);
+        return;
+    }
+    if (bridge <= limit)
+    {
+        ScratchScope scratch;
+        T *temp = scratch.alloc<T>(bridge);
+        if (left < right)
+        {
+            memcpy(temp, arr + left, bridge * sizeof(T));
+            for (size_t k = 0; k < left; k++)
+            {
+                arr[right - 1 - k] = arr[n - 1 - k]; // tail of B moves next to the bridge
+                arr[n - 1 - k] = arr[left - 1 - k];  // A moves to the end
+            }
+            memcpy(arr, temp, bridge * sizeof(T));
+        }
+        else
+        {
+            memcpy(temp, arr + right, bridge * sizeof(T));
+            for (size_t k = 0; k < right; k++)
+            {
+                arr[right + k] = arr[k];  // head of A moves right
+                arr[k] = arr[left + k];   // B moves to the front
+            }
+            memcpy(arr + (n - bridge), temp, bridge * sizeof(T));
+        }
+        return;
+    }
+
+    rotateReversal(arr, n, d);
+}
+
+// Picks an algorithm by shape; thresholds chosen from the matrix in main()
+template <typename T>
+void rotateLeft(T arr[], size_t n, size_t d)
+{
+    if (n == 0)
+        return;
+    d %= n;
+    if (d == 0)
+        return;
+
+    size_t shortSide = min(d, n - d);
+    size_t limit = SCRATCH_LIMIT_BYTES / sizeof(T);
+
+    // Buffered moves run at memcpy/memmove speed: best whenever scratch stays bounded
+    if (shortSide <= limit || max(d, n - d) - shortSide <= limit)
+    {
+        rotateTrinity(arr, n, d);
+        return;
+    }
+
+    // Otherwise block swap: ~1 sequential swap per element. Juggling never won
+    // in the matrix (strided access), and reversal does about twice the work.
+    rotateBlockSwap(arr, n, d);
+}
+
+struct Wide
+{
+    long long a, b; // 16-byte element to show element-size effects
+    bool operator==(const Wide &o) const { return a == o.a && b == o.b; }
+};
+
+template <typename T>
+T makeValue(size_t i);
+template <>
+int makeValue<int>(size_t i) { return (int)i; }
+template <>
+Wide makeValue<Wide>(size_t i) { return Wide{(long long)i, -(long long)i}; }
+
+template <typename T>
+void benchMatrix(const char *typeName)
+{
+    typedef void (*RotateFn)(T *, size_t, size_t);
+    struct Algo
+    {
+        const char *name;
+        RotateFn fn;
+    };
+    Algo algos[] = {{"temp", rotateTempBuffer<T>},
+                    {"reverse", rotateReversal<T>},
+                    {"juggle", rotateJuggling<T>},
+                    {"blockswap", rotateBlockSwap<T>},
+                    {"trinity", rotateTrinity<T>},
+                    {"selector", rotateLeft<T>}};
+
+    size_t sizesBytes[] = {16 << 10, 256 << 10, 4 << 20, 64 << 20}; // ~L1, L2, L3, DRAM
+    double ratios[] = {0.001, 0.1, 0.33, 0.5, 0.9};
+
+    cout << "\n=== element " << typeName << " (" << sizeof(T) << " bytes), ns per element ===" << endl;
+    cout << "size      D/N    ";
+    for (auto &a : algos)
+        cout << a.name << "  ";
+    cout << endl;
+
+    for (size_t bytes : sizesBytes)
+    {
+        size_t n = bytes / sizeof(T);
+        vector<T> arr(n), expected(n);
+        size_t reps = max<size_t>(1, (64 << 20) / bytes);
+
+        for (double ratio : ratios)
+        {
+            size_t d = max<size_t>(1, (size_t)(n * ratio));
+            for (size_t i = 0; i < n; i++)
+                expected[i] = makeValue<T>((i + d) % n);
+
+            cout << (bytes >> 10) << "KB\t" << ratio << "\t";
+            for (auto &a : algos)
+            {
+                for (size_t i = 0; i < n; i++)
+                    arr[i] = makeValue<T>(i);
+                a.fn(arr.data(), n, d); // warm-up + correctness check
+                bool ok = equal(arr.begin(), arr.end(), expected.begin());
+
+                auto t0 = chrono::high_resolution_clock::now();
+                for (size_t r = 0; r < reps; r++)
+                    a.fn(arr.data(), n, d);
+                auto t1 = chrono::high_resolution_clock::now();
+                double ns = chrono::duration<double, nano>(t1 - t0).count() / (reps * (double)n);
+                cout << ns << (ok ? "" : "!") << "  ";
+            }
+            cout << endl;
+        }
+    }
+}
+
+int main()
+{
+    // Small example (same as optimal.cpp), rotated by the selector
+    int arr[] = {1, 2, 3, 4, 5, 6};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    rotateLeft(arr, n, 2);
+
+    cout << "Array after rotation: ";
+    for (int i = 0; i < n; i++)
+        cout << arr[i] << " ";
+    cout << endl;
+
+    // Benchmark matrix ("!" marks a wrong result)
+    benchMatrix<int>("int");
+    benchMatrix<Wide>("Wide");
+
+    return 0;
+}
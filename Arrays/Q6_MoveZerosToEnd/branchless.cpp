@@ -0,0 +1,198 @@
+/*
+ * Move All Zeros to End - Branchless Scalar Compaction
+ *
+ * Problem: Same as optimal.cpp. When zeros are scattered at random, the
+ * `if (arr[i] != 0)` test is unpredictable and the CPU mispredicts it about
+ * half the time at 50% zeros, throwing away ~15-20 cycles each time.
+ *
+ * Approach (unconditional store + conditional increment):
+ * - Always write the current element to the write slot: arr[w] = arr[i].
+ * - Advance the write slot only if the element was non-zero:
+ *   w += (arr[i] != 0). The comparison becomes a setcc/add, not a jump.
+ * - A zero is written and then overwritten by the next non-zero, so the
+ *   non-zeros end up compacted in order; finally fill [w, n) with zeros.
+ * - This is the portable fallback for CPUs without a fast SIMD compress
+ *   (see simd.cpp for the AVX2/AVX-512 kernels).
+ *
+ * Measurement: on Linux the benchmark reads the hardware branch-miss counter
+ * through perf_event_open. If the kernel does not allow it (containers, VMs,
+ * perf_event_paranoid), it prints "n/a" and still reports the timings.
+ *
+ * Complexity:
+ * - Time: O(n) with no data-dependent branches in the loop
+ * - Space: O(1)
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+// Baseline from optimal.cpp: first zero index plus swaps
+void moveZerosSwap(int arr[], size_t n)
+{
+    size_t j = 0;
+    while (j < n && arr[j] != 0)
+        j++;
+    for (size_t i = j + 1; i < n; i++)
+    {
+        if (arr[i] != 0)
+        {
+            swap(arr[i], arr[j]);
+            j++;
+        }
+    }
+}
+
+// Branchy compaction (same data movement as the branchless one, but with a jump)
+void moveZerosBranchy(int arr[], size_t n)
+{
+    size_t w = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (arr[i] != 0)
+            arr[w++] = arr[i];
+    }
+    fill(arr + w, arr + n, 0);
+}
+
+void moveZerosBranchless(int arr[], size_t n)
+{
+    size_t w = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        int x = arr[i];
+        arr[w] = x;    // unconditional store
+        w += (x != 0); // conditional increment, no branch
+    }
+    fill(arr + w, arr + n, 0);
+}
+
+// Hardware branch-miss counter (returns -1 when unavailable)
+class BranchMissCounter
+{
+private:
+    int fd = -1;
+
+public:
+    BranchMissCounter()
+    {
+#ifdef __linux__
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+
+    ~BranchMissCounter()
+    {
+#ifdef __linux__
+        if (fd >= 0)
+            close(fd);
+#endif
+    }
+
+    bool available() const { return fd >= 0; }
+
+    void start()
+    {
+#ifdef __linux__
+        if (fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    long long stop()
+    {
+#ifdef __linux__
+        if (fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            long long count = 0;
+            if (read(fd, &count, sizeof(count)) == (ssize_t)sizeof(count))
+                return count;
+        }
+#endif
+        return -1;
+    }
+};
+
+int main()
+{
+    // Small example
+    int arr[] = {1, 2, 0, 3, 4, 0, 3, 5};
+    size_t n = sizeof(arr) / sizeof(arr[0]);
+    moveZerosBranchless(arr, n);
+    cout << "Result: ";
+    for (size_t k = 0; k < n; k++)
+        cout << arr[k] << " ";
+    cout << endl;
+
+    // Benchmark at 1%, 50% and 99% zeros
+    const size_t N = 1 << 24;
+    double densities[] = {0.01, 0.5, 0.99};
+
+    struct Kernel
+    {
+        const char *name;
+        void (*fn)(int *, size_t);
+    };
+    Kernel kernels[] = {{"swap (optimal.cpp)", moveZerosSwap},
+                        {"branchy compact   ", moveZerosBranchy},
+                        {"branchless        ", moveZerosBranchless}};
+
+    BranchMissCounter counter;
+    if (!counter.available())
+        cout << "(perf_event_open not permitted here: branch-miss rate shown as n/a)" << endl;
+
+    for (double density : densities)
+    {
+        mt19937 rng(12);
+        bernoulli_distribution isZero(density);
+        vector<int> input(N);
+        for (size_t i = 0; i < N; i++)
+            input[i] = isZero(rng) ? 0 : (int)(rng() % 1000) + 1;
+
+        vector<int> expected = input;
+        stable_partition(expected.begin(), expected.end(), [](int x)
+                         { return x != 0; });
+
+        cout << "--- " << density * 100 << "% zeros ---" << endl;
+        for (auto &k : kernels)
+        {
+            vector<int> work = input;
+            counter.start();
+            auto t0 = chrono::high_resolution_clock::now();
+            k.fn(work.data(), N);
+            auto t1 = chrono::high_resolution_clock::now();
+            long long misses = counter.stop();
+
+            cout << k.name << ": " << chrono::duration<double, milli>(t1 - t0).count() << " ms, branch misses/element: ";
+            if (misses >= 0)
+                cout << (double)misses / N;
+            else
+                cout << "n/a";
+            cout << (work == expected ? "" : "  [MISMATCH]") << endl;
+        }
+    }
+
+    return 0;
+}
@@ -11,6 +11,8 @@
  *
  * Properties:
  * - Stability preserved for non-zero elements (relative order unchanged)
+ * - `temp` is drawn from the thread-local ScratchArena, so repeated calls reuse
+ *   the same memory
  *
  * Complexity:
  * - Time: O(n) two linear passes
@@ -18,6 +20,7 @@
  */
 
 #include <iostream>
+#include "../../utility_files/ScratchArena.h"
 using namespace std;
 
 int main()
@@ -29,7 +32,8 @@ int main()
     int n = sizeof(arr) / sizeof(arr[0]);
 
     // Temporary array to store the rearranged elements (non-zeros first)
-    int temp[n];
+    ScratchScope scratch;
+    int *temp = scratch.alloc<int>(n);
 
     // Write index for the temp array (next position to fill with a non-zero)
     int index = 0;
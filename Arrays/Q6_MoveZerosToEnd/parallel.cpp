@@ -0,0 +1,91 @@
+/*
+ * Move All Zeros to End - Parallel Stable Partition
+ *
+ * Problem: Same as optimal.cpp — move zeros to the end and keep non-zero
+ * elements in order — but for arrays large enough to need several cores.
+ *
+ * Approach: moving zeros to the end IS a stable partition with the predicate
+ * `x != 0`, so this program just calls the shared primitives in
+ * utility_files/ParallelPartition.h:
+ * - Out-of-place: threads count non-zeros per chunk, an exclusive scan gives
+ *   every chunk its destination offsets, and a second parallel pass scatters.
+ * - In-place (bounded scratch): blocks are partitioned in parallel with a
+ *   per-thread scratch buffer, then merged pairwise with rotations.
+ *
+ * Complexity:
+ * - Out-of-place: O(n / T) per thread, O(n) output buffer
+ * - In-place: O(n / T) for the blocks plus O(n log(n / B)) worst case for the
+ *   merge rotations; O(B) scratch per thread
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "../../utility_files/ParallelPartition.h"
+using namespace std;
+
+struct NonZero
+{
+    bool operator()(int x) const { return x != 0; }
+};
+
+// Zeros end up at the tail because they fail the predicate
+void moveZerosParallel(int arr[], size_t n, unsigned threads)
+{
+    parallelStablePartitionInPlace(arr, n, NonZero(), threads);
+}
+
+void moveZerosParallelCopy(const int arr[], size_t n, int out[], unsigned threads)
+{
+    parallelStablePartitionCopy(arr, n, out, NonZero(), threads);
+}
+
+int main()
+{
+    // Small example
+    int arr[] = {1, 2, 0, 3, 4, 0, 3, 5};
+    size_t n = sizeof(arr) / sizeof(arr[0]);
+
+    moveZerosParallel(arr, n, 2);
+    cout << "Result: ";
+    for (size_t k = 0; k < n; k++)
+        cout << arr[k] << " ";
+    cout << endl;
+
+    // Scaling benchmark: 2^26 ints with 30% zeros
+    const size_t N = 1 << 26;
+    vector<int> input(N);
+    mt19937 rng(4);
+    for (size_t i = 0; i < N; i++)
+        input[i] = (rng() % 10 < 3) ? 0 : (int)(rng() % 1000) + 1;
+
+    vector<int> expected = input;
+    stable_partition(expected.begin(), expected.end(), NonZero());
+
+    unsigned maxThreads = max(1u, thread::hardware_concurrency());
+    vector<unsigned> counts;
+    for (unsigned t = 1; t < maxThreads; t *= 2)
+        counts.push_back(t);
+    counts.push_back(maxThreads);
+
+    vector<int> work(N), out(N);
+    for (unsigned t : counts)
+    {
+        auto t0 = chrono::high_resolution_clock::now();
+        moveZerosParallelCopy(input.data(), N, out.data(), t);
+        auto t1 = chrono::high_resolution_clock::now();
+
+        work = input;
+        auto t2 = chrono::high_resolution_clock::now();
+        moveZerosParallel(work.data(), N, t);
+        auto t3 = chrono::high_resolution_clock::now();
+
+        cout << t << " thread(s): out-of-place " << chrono::duration<double, milli>(t1 - t0).count()
+             << " ms, in-place " << chrono::duration<double, milli>(t3 - t2).count() << " ms"
+             << (out == expected && work == expected ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
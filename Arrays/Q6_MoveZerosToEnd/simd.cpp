@@ -0,0 +1,248 @@
+/*
+ * Move All Zeros to End - Stable SIMD Compaction (Predicate-Based remove_if)
+ *
+ * Problem: Same as optimal.cpp — move all zeros to the end in-place while
+ * keeping the non-zero elements in their original order.
+ *
+ * Why not swap: optimal.cpp swaps every non-zero with the first zero slot, so
+ * each kept element costs a read-modify-write of two locations, plus a
+ * data-dependent branch per element.
+ *
+ * Approach (compact, then fill):
+ * 1) Compaction: compare 8 (AVX2) or 16 (AVX-512) elements with the predicate
+ *    at once to get a bitmask of elements to KEEP. AVX2 looks the mask up in a
+ *    256-entry shuffle table that packs the kept lanes to the front; AVX-512
+ *    uses its native compress. The packed register is stored at the write
+ *    pointer, which then moves forward by popcount(mask).
+ * 2) Fill: everything from the write pointer to the end becomes zero, written
+ *    with wide stores (std::fill vectorizes to full-width stores).
+ *
+ * Generalization: the compaction is `removeIf(arr, n, pred)`, which returns the
+ * new logical end like std::remove_if. A predicate supplies a scalar test and
+ * a vector test; move-zeros is removeIf(IsZero) followed by the zero fill.
+ *
+ * In-place safety: the write pointer never passes the read pointer, and each
+ * store ends before the next block we load.
+ *
+ * Complexity:
+ * - Time: O(n), n / 8 or n / 16 vector steps, no data-dependent branches
+ * - Space: O(1) extra (plus a fixed 8 KB shuffle table for AVX2)
+ *
+ * Compile with: g++ -O2 -march=native simd.cpp
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#ifdef __AVX2__
+#include <immintrin.h>
+#include "../../utility_files/CompactLUT.h"
+#endif
+using namespace std;
+
+// ---- Predicates (what to REMOVE) ----
+
+struct IsZero
+{
+    bool scalar(int x) const { return x == 0; }
+#ifdef __AVX2__
+    __m256i vec(__m256i v) const { return _mm256_cmpeq_epi32(v, _mm256_setzero_si256()); }
+#endif
+#ifdef __AVX512F__
+    __mmask16 mask16(__m512i v) const { return _mm512_cmpeq_epi32_mask(v, _mm512_setzero_si512()); }
+#endif
+};
+
+struct IsNegative
+{
+    bool scalar(int x) const { return x < 0; }
+#ifdef __AVX2__
+    __m256i vec(__m256i v) const { return _mm256_cmpgt_epi32(_mm256_setzero_si256(), v); }
+#endif
+#ifdef __AVX512F__
+    __mmask16 mask16(__m512i v) const { return _mm512_cmplt_epi32_mask(v, _mm512_setzero_si512()); }
+#endif
+};
+
+// ---- Scalar kernels ----
+
+// Baseline from optimal.cpp: first-zero index plus swaps
+void moveZerosSwap(int arr[], size_t n)
+{
+    size_t j = 0;
+    while (j < n && arr[j] != 0)
+        j++;
+    for (size_t i = j + 1; i < n; i++)
+    {
+        if (arr[i] != 0)
+        {
+            swap(arr[i], arr[j]);
+            j++;
+        }
+    }
+}
+
+template <typename Pred>
+size_t removeIfScalar(int arr[], size_t n, Pred pred)
+{
+    size_t w = 0;
+    for (size_t i = 0; i < n; i++)
+        if (!pred.scalar(arr[i]))
+            arr[w++] = arr[i];
+    return w;
+}
+
+// ---- SIMD kernels ----
+
+#ifdef __AVX2__
+template <typename Pred>
+size_t removeIfAVX2(int arr[], size_t n, Pred pred)
+{
+    size_t w = 0, i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(arr + i));
+        unsigned drop = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(pred.vec(v)));
+        unsigned keep = ~drop & 0xFF;
+
+        __m256i perm = _mm256_load_si256((const __m256i *)compactLUT.perm[keep]);
+        _mm256_storeu_si256((__m256i *)(arr + w), _mm256_permutevar8x32_epi32(v, perm));
+        w += __builtin_popcount(keep);
+    }
+    for (; i < n; i++)
+        if (!pred.scalar(arr[i]))
+            arr[w++] = arr[i];
+    return w;
+}
+#endif
+
+#ifdef __AVX512F__
+template <typename Pred>
+size_t removeIfAVX512(int arr[], size_t n, Pred pred)
+{
+    size_t w = 0, i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m512i v = _mm512_loadu_si512((const void *)(arr + i));
+        __mmask16 keep = (__mmask16)~pred.mask16(v);
+        _mm512_storeu_si512((void *)(arr + w), _mm512_maskz_compress_epi32(keep, v));
+        w += __builtin_popcount(keep);
+    }
+    for (; i < n; i++)
+        if (!pred.scalar(arr[i]))
+            arr[w++] = arr[i];
+    return w;
+}
+#endif
+
+// Best compaction kernel for this build
+template <typename Pred>
+size_t removeIf(int arr[], size_t n, Pred pred)
+{
+#if defined(__AVX512F__)
+    return removeIfAVX512(arr, n, pred);
+#elif defined(__AVX2__)
+    return removeIfAVX2(arr, n, pred);
+#else
+    return removeIfScalar(arr, n, pred);
+#endif
+}
+
+void moveZerosScalarCompact(int arr[], size_t n)
+{
+    size_t w = removeIfScalar(arr, n, IsZero());
+    fill(arr + w, arr + n, 0);
+}
+
+#ifdef __AVX2__
+void moveZerosAVX2(int arr[], size_t n)
+{
+    size_t w = removeIfAVX2(arr, n, IsZero());
+    fill(arr + w, arr + n, 0);
+}
+#endif
+
+#ifdef __AVX512F__
+void moveZerosAVX512(int arr[], size_t n)
+{
+    size_t w = removeIfAVX512(arr, n, IsZero());
+    fill(arr + w, arr + n, 0);
+}
+#endif
+
+void moveZeros(int arr[], size_t n)
+{
+    size_t w = removeIf(arr, n, IsZero());
+    fill(arr + w, arr + n, 0);
+}
+
+int main()
+{
+    // Small example (with zeros, unlike optimal.cpp's sample)
+    int arr[] = {1, 2, 0, 3, 4, 0, 3, 5, 0, 0, 7, 8, 0, 9, 10, 11, 0, 12, 13};
+    size_t n = sizeof(arr) / sizeof(arr[0]);
+
+    moveZeros(arr, n);
+    cout << "Result: ";
+    for (size_t k = 0; k < n; k++)
+        cout << arr[k] << " ";
+    cout << endl;
+
+    // remove_if with another predicate: drop negatives
+    int mixed[] = {3, -1, 4, -1, -5, 9, 2, -6, 5, 3, -5, 8, 9, -7, 9, 3, 2, -3};
+    size_t m = sizeof(mixed) / sizeof(mixed[0]);
+    size_t kept = removeIf(mixed, m, IsNegative());
+    cout << "Non-negatives kept in order: ";
+    for (size_t k = 0; k < kept; k++)
+        cout << mixed[k] << " ";
+    cout << endl;
+
+    // Benchmark across zero densities
+    const size_t N = 1 << 24;
+    double densities[] = {0.0, 0.01, 0.1, 0.5, 0.9, 0.99};
+
+    struct Kernel
+    {
+        const char *name;
+        void (*fn)(int *, size_t);
+    };
+    vector<Kernel> kernels = {{"swap (optimal.cpp)", moveZerosSwap},
+                              {"scalar compact    ", moveZerosScalarCompact}};
+#ifdef __AVX2__
+    kernels.push_back({"AVX2 compact      ", moveZerosAVX2});
+#endif
+#ifdef __AVX512F__
+    kernels.push_back({"AVX-512 compress  ", moveZerosAVX512});
+#endif
+
+    for (double density : densities)
+    {
+        mt19937 rng(9);
+        bernoulli_distribution isZero(density);
+        vector<int> input(N);
+        for (size_t i = 0; i < N; i++)
+            input[i] = isZero(rng) ? 0 : (int)(rng() % 1000) + 1;
+
+        vector<int> expected = input;
+        stable_partition(expected.begin(), expected.end(), [](int x)
+                         { return x != 0; });
+
+        cout << "--- zero density " << density * 100 << "% ---" << endl;
+        for (auto &k : kernels)
+        {
+            vector<int> work = input;
+            auto t0 = chrono::high_resolution_clock::now();
+            k.fn(work.data(), N);
+            auto t1 = chrono::high_resolution_clock::now();
+            double sec = chrono::duration<double>(t1 - t0).count();
+            cout << k.name << ": " << sec * 1e3 << " ms, "
+                 << N * sizeof(int) / sec / 1e9 << " GB/s"
+                 << (work == expected ? "" : "  [MISMATCH]") << endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,244 @@
+/*
+ * Union of Sorted Arrays - K-Way Distinct Union with a Loser Tree
+ *
+ * Problem: Given K sorted arrays (each may contain duplicates), produce the
+ * sorted list of DISTINCT values that appear in any of them. optimal.cpp
+ * handles K = 2; here K is in the hundreds.
+ *
+ * Approach (tournament / loser tree):
+ * - Each run has a "head" (its next unread value). A loser tree is a complete
+ *   binary tree over the K heads: every internal node stores the LOSER of the
+ *   match played there (the larger key), and node 0 stores the overall winner
+ *   (the smallest head).
+ * - Pop the winner, append it to the output unless it equals the last value
+ *   written (the same duplicate check as optimal.cpp), advance that run, and
+ *   replay only the path from its leaf to the root: log2(K) comparisons, each
+ *   against a node that is not modified by the sibling subtree.
+ * - Cache-friendly layout: nodes live in one flat array in heap order, and
+ *   each node stores its key next to the run index, so a replay never has to
+ *   follow a pointer back into the input runs.
+ * - Exhausted runs get key +infinity (64-bit keys, so INT_MAX stays a valid value).
+ * - Output goes into a caller-provided buffer; the return value is its length.
+ *
+ * Complexity:
+ * - Time: O(N log K) for N total input elements
+ * - Space: O(K) for the tree (output buffer is provided by the caller)
+ */
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <algorithm>
+using namespace std;
+
+class LoserTree
+{
+private:
+    struct Node
+    {
+        int64_t key; // head value of the run, or INF when exhausted
+        int run;
+    };
+
+    static const int64_t INF = INT64_MAX;
+
+    vector<const int *> pos, end;
+    vector<Node> nodes; // nodes[0] = winner, nodes[1..P) = losers
+    size_t P;           // number of leaves, K rounded up to a power of two
+
+    // Runs are padded to P with empty ranges, so no bounds check is needed
+    int64_t headKey(int run) const
+    {
+        return pos[run] != end[run] ? *pos[run] : INF;
+    }
+
+public:
+    LoserTree(const vector<pair<const int *, size_t>> &runs)
+    {
+        size_t k = runs.size();
+        P = 1;
+        while (P < k)
+            P *= 2;
+
+        for (auto &r : runs)
+        {
+            pos.push_back(r.first);
+            end.push_back(r.first + r.second);
+        }
+        pos.resize(P, nullptr);
+        end.resize(P, nullptr);
+
+        // Play the initial tournament bottom-up, keeping the winners in `win`
+        vector<Node> win(2 * P);
+        for (size_t i = 0; i < P; i++)
+            win[P + i] = {headKey((int)i), (int)i};
+
+        nodes.assign(P, {INF, -1});
+        for (size_t node = P - 1; node >= 1; node--)
+        {
+            const Node &a = win[2 * node], &b = win[2 * node + 1];
+            bool aWins = a.key <= b.key;
+            win[node] = aWins ? a : b;
+            nodes[node] = aWins ? b : a;
+        }
+        nodes[0] = win[1];
+    }
+
+    bool empty() const { return nodes[0].key == INF; }
+    int top() const { return (int)nodes[0].key; }
+
+    // Advance the winning run and replay its path to the root
+    void pop()
+    {
+        int run = nodes[0].run;
+        pos[run]++;
+        Node cur = {headKey(run), run};
+
+        // Select instead of branching: the outcome of each match is unpredictable
+        for (size_t node = (P + run) / 2; node >= 1; node /= 2)
+        {
+            Node other = nodes[node];
+            bool otherWins = other.key < cur.key;
+            nodes[node] = otherWins ? cur : other;
+            cur = otherWins ? other : cur;
+        }
+        nodes[0] = cur;
+    }
+};
+
+// Distinct union of all runs into out; returns the number of values written
+size_t kWayUnion(const vector<pair<const int *, size_t>> &runs, int out[])
+{
+    if (runs.empty())
+        return 0;
+
+    LoserTree tree(runs);
+    size_t count = 0;
+    while (!tree.empty())
+    {
+        int x = tree.top();
+        if (count == 0 || out[count - 1] != x)
+            out[count++] = x;
+        tree.pop();
+    }
+    return count;
+}
+
+// Two-pointer distinct union from optimal.cpp
+size_t unionTwo(const int *a, size_t n1, const int *b, size_t n2, int out[])
+{
+    size_t i = 0, j = 0, k = 0;
+    while (i < n1 && j < n2)
+    {
+        int x;
+        if (a[i] < b[j])
+            x = a[i++];
+        else if (b[j] < a[i])
+            x = b[j++];
+        else
+        {
+            x = a[i];
+            i++;
+            j++;
+        }
+        if (k == 0 || out[k - 1] != x)
+            out[k++] = x;
+    }
+    for (; i < n1; i++)
+        if (k == 0 || out[k - 1] != a[i])
+            out[k++] = a[i];
+    for (; j < n2; j++)
+        if (k == 0 || out[k - 1] != b[j])
+            out[k++] = b[j];
+    return k;
+}
+
+// Baseline: balanced rounds of pairwise unions
+vector<int> pairwiseUnion(const vector<vector<int>> &runs)
+{
+    vector<vector<int>> level = runs;
+    while (level.size() > 1)
+    {
+        vector<vector<int>> next;
+        for (size_t i = 0; i + 1 < level.size(); i += 2)
+        {
+            vector<int> merged(level[i].size() + level[i + 1].size());
+            merged.resize(unionTwo(level[i].data(), level[i].size(),
+                                   level[i + 1].data(), level[i + 1].size(), merged.data()));
+            next.push_back(move(merged));
+        }
+        if (level.size() % 2 == 1)
+            next.push_back(move(level.back()));
+        level = move(next);
+    }
+    return level.empty() ? vector<int>() : level[0];
+}
+
+// Baseline from brute.cpp: insert everything into a std::set
+vector<int> setUnion(const vector<vector<int>> &runs)
+{
+    set<int> st;
+    for (auto &r : runs)
+        for (int x : r)
+            st.insert(x);
+    return vector<int>(st.begin(), st.end());
+}
+
+int main()
+{
+    // Small example: three sorted arrays with duplicates
+    vector<vector<int>> small = {{1, 2, 2, 3, 4, 4, 5, 6}, {2, 3, 3, 4, 5, 5}, {0, 6, 7, 7, 9}};
+    vector<pair<const int *, size_t>> smallRuns;
+    size_t smallTotal = 0;
+    for (auto &r : small)
+    {
+        smallRuns.push_back({r.data(), r.size()});
+        smallTotal += r.size();
+    }
+    vector<int> smallOut(smallTotal);
+    size_t u = kWayUnion(smallRuns, smallOut.data());
+
+    cout << "Union: ";
+    for (size_t i = 0; i < u; i++)
+        cout << smallOut[i] << " ";
+    cout << endl;
+
+    // Benchmark: K sorted runs with overlapping value ranges and duplicates
+    const size_t K = 256;
+    const size_t RUN = 40000;
+    vector<vector<int>> runs(K);
+    mt19937 rng(17);
+    for (auto &r : runs)
+    {
+        r.resize(RUN);
+        for (auto &x : r)
+            x = (int)(rng() % (K * RUN / 2));
+        sort(r.begin(), r.end());
+    }
+
+    vector<pair<const int *, size_t>> views;
+    for (auto &r : runs)
+        views.push_back({r.data(), r.size()});
+    vector<int> out(K * RUN); // preallocated output
+
+    auto t0 = chrono::high_resolution_clock::now();
+    size_t count = kWayUnion(views, out.data());
+    auto t1 = chrono::high_resolution_clock::now();
+    vector<int> pairwise = pairwiseUnion(runs);
+    auto t2 = chrono::high_resolution_clock::now();
+    vector<int> viaSet = setUnion(runs);
+    auto t3 = chrono::high_resolution_clock::now();
+
+    bool ok = count == pairwise.size() && equal(pairwise.begin(), pairwise.end(), out.begin()) && pairwise == viaSet;
+    cout << K << " runs x " << RUN << " elements -> " << count << " distinct values" << endl;
+    cout << "loser tree : " << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+    cout << "pairwise   : " << chrono::duration<double, milli>(t2 - t1).count() << " ms" << endl;
+    cout << "std::set   : " << chrono::duration<double, milli>(t3 - t2).count() << " ms" << endl;
+    cout << (ok ? "All results match" : "MISMATCH") << endl;
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * Union of Two Sorted Arrays - Parallel Merge Path (Distinct Output)
+ *
+ * Problem: Same as optimal.cpp (sorted distinct union of two sorted arrays
+ * with duplicates), but for arrays so large that the sequential two-pointer
+ * loop is the bottleneck.
+ *
+ * Approach (merge path):
+ * - Think of the merge as a path through an n1 x n2 grid. Cutting the path on
+ *   the diagonals i + j = p * (n1 + n2) / T gives T partitions that each hold
+ *   the same number of input elements. The cut on a diagonal is found by
+ *   binary search: the largest i with arr1[i - 1] <= arr2[d - i] (ties take
+ *   arr1 first, exactly like optimal.cpp).
+ * - Every element before a cut is <= every element after it, so the
+ *   partitions can be merged independently.
+ * - Duplicates across a border: partition p knows the last value that comes
+ *   before it, max(arr1[i - 1], arr2[j - 1]). Its own output is already
+ *   distinct, so only its FIRST value can repeat that; it is dropped if equal.
+ * - Output placement: pass 1 (parallel) only counts each partition's distinct
+ *   values, an exclusive prefix sum turns counts into offsets, and pass 2
+ *   (parallel) merges again, writing straight into the single output array.
+ *
+ * Complexity:
+ * - Time: O((n1 + n2) / T + T log(n1 + n2)) per pass
+ * - Space: O(T) besides the output
+ */
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "../../utility_files/ThreadUtils.h"
+using namespace std;
+
+// Split point on diagonal d: i elements from a, d - i from b
+size_t mergePathSplit(const int a[], size_t n1, const int b[], size_t n2, size_t d)
+{
+    size_t lo = d > n2 ? d - n2 : 0;
+    size_t hi = min(d, n1);
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (a[mid] <= b[d - mid - 1])
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// Distinct union of a[i0, i1) and b[j0, j1), skipping `prev` if hasPrev.
+// With out == nullptr it only counts.
+size_t unionRange(const int a[], size_t i0, size_t i1, const int b[], size_t j0, size_t j1,
+                  bool hasPrev, int prev, int out[])
+{
+    size_t k = 0;
+    bool haveLast = hasPrev;
+    int last = prev;
+
+    auto emit = [&](int x)
+    {
+        if (!haveLast || x != last)
+        {
+            if (out)
+                out[k] = x;
+            k++;
+            last = x;
+            haveLast = true;
+        }
+    };
+
+    size_t i = i0, j = j0;
+    while (i < i1 && j < j1)
+    {
+        if (a[i] < b[j])
+            emit(a[i++]);
+        else if (b[j] < a[i])
+            emit(b[j++]);
+        else
+        {
+            emit(a[i]);
+            i++;
+            j++;
+        }
+    }
+    while (i < i1)
+        emit(a[i++]);
+    while (j < j1)
+        emit(b[j++]);
+    return k;
+}
+
+// Returns the union length; out must have room for n1 + n2 values
+size_t parallelUnion(const int a[], size_t n1, const int b[], size_t n2, int out[], unsigned threads)
+{
+    size_t total = n1 + n2;
+    threads = max(1u, min<unsigned>(threads, (unsigned)(total / 4096 + 1)));
+
+    // Cuts: partition p covers a[ia[p], ia[p+1]) and b[jb[p], jb[p+1])
+    vector<size_t> ia(threads + 1), jb(threads + 1);
+    for (unsigned p = 0; p <= threads; p++)
+    {
+        size_t d = total * p / threads;
+        ia[p] = mergePathSplit(a, n1, b, n2, d);
+        jb[p] = d - ia[p];
+    }
+
+    // Last value before each cut (for the border duplicate check)
+    vector<char> hasPrev(threads);
+    vector<int> prev(threads);
+    for (unsigned p = 0; p < threads; p++)
+    {
+        hasPrev[p] = ia[p] > 0 || jb[p] > 0;
+        if (ia[p] > 0 && jb[p] > 0)
+            prev[p] = max(a[ia[p] - 1], b[jb[p] - 1]);
+        else if (ia[p] > 0)
+            prev[p] = a[ia[p] - 1];
+        else if (jb[p] > 0)
+            prev[p] = b[jb[p] - 1];
+    }
+
+    // PASS 1: count distinct outputs per partition
+    vector<size_t> count(threads), offset(threads);
+    runOnThreads(threads, [&](unsigned p)
+                 { count[p] = unionRange(a, ia[p], ia[p + 1], b, jb[p], jb[p + 1], hasPrev[p], prev[p], nullptr); });
+
+    // Exclusive prefix sum -> output offsets
+    size_t sum = 0;
+    for (unsigned p = 0; p < threads; p++)
+    {
+        offset[p] = sum;
+        sum += count[p];
+    }
+
+    // PASS 2: merge each partition straight into its slot
+    runOnThreads(threads, [&](unsigned p)
+                 { unionRange(a, ia[p], ia[p + 1], b, jb[p], jb[p + 1], hasPrev[p], prev[p], out + offset[p]); });
+
+    return sum;
+}
+
+int main()
+{
+    // Sorted input arrays (same as optimal.cpp)
+    int arr1[] = {1, 2, 2, 3, 4, 4, 5, 6};
+    int arr2[] = {2, 3, 3, 4, 5, 5};
+    size_t n1 = sizeof(arr1) / sizeof(arr1[0]);
+    size_t n2 = sizeof(arr2) / sizeof(arr2[0]);
+
+    vector<int> unionArr(n1 + n2);
+    unionArr.resize(parallelUnion(arr1, n1, arr2, n2, unionArr.data(), 3));
+    cout << "Union: ";
+    for (int x : unionArr)
+        cout << x << " ";
+    cout << endl;
+
+    // Scaling benchmark: two 2^25-element sorted arrays with many duplicates
+    const size_t N = 1 << 25;
+    vector<int> a(N), b(N);
+    mt19937 rng(21);
+    for (size_t i = 0; i < N; i++)
+    {
+        a[i] = (int)(rng() % (N / 2));
+        b[i] = (int)(rng() % (N / 2));
+    }
+    sort(a.begin(), a.end());
+    sort(b.begin(), b.end());
+
+    vector<int> expected(2 * N), out(2 * N);
+    auto s0 = chrono::high_resolution_clock::now();
+    size_t expectedCount = unionRange(a.data(), 0, N, b.data(), 0, N, false, 0, expected.data());
+    auto s1 = chrono::high_resolution_clock::now();
+    cout << "sequential two-pointer: " << chrono::duration<double, milli>(s1 - s0).count() << " ms" << endl;
+
+    unsigned maxThreads = max(1u, thread::hardware_concurrency());
+    vector<unsigned> counts;
+    for (unsigned t = 1; t < maxThreads; t *= 2)
+        counts.push_back(t);
+    counts.push_back(maxThreads);
+
+    for (unsigned t : counts)
+    {
+        auto t0 = chrono::high_resolution_clock::now();
+        size_t c = parallelUnion(a.data(), N, b.data(), N, out.data(), t);
+        auto t1 = chrono::high_resolution_clock::now();
+        bool ok = c == expectedCount && equal(out.begin(), out.begin() + c, expected.begin());
+        cout << t << " thread(s): " << chrono::duration<double, milli>(t1 - t0).count() << " ms"
+             << (ok ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * Union / Intersection of Integer Sets - Compressed Bitmap Containers
+ *
+ * Problem: Same sets as optimal.cpp here and Q8's optimal.cpp, but dense:
+ * when a large share of a value range is present, a sorted int array spends
+ * 32 bits per member and the two-pointer loops touch every one of them.
+ *
+ * Approach (utility_files/RoaringSet.h):
+ * - Split each value into a 16-bit chunk key and a 16-bit low half. Each chunk
+ *   stores its low halves as a sorted uint16 array (<= 4096 members), a
+ *   65536-bit bitmap (denser chunks), or a list of runs (after runOptimize()).
+ * - Union / intersection / difference walk the two key lists like the
+ *   two-pointer merge and combine matching containers: bitmap OR/AND/ANDNOT
+ *   a word at a time, array merges, array-vs-bitmap bit tests, run interval
+ *   merges.
+ * - Built from and exported to the sorted int arrays used by the other programs.
+ *
+ * Notes:
+ * - Set semantics: duplicates collapse. That matches optimal.cpp's distinct
+ *   union. For Q8's multiset intersection it only agrees on duplicate-free input,
+ *   which is what the benchmark uses.
+ *
+ * Complexity:
+ * - Time: O(chunks + container work); bitmap chunks cost 1024 word ops each
+ *   regardless of how many members they hold
+ * - Space: about min(2 bytes/member, 8 KB/chunk, 4 bytes/run) per chunk
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "../../utility_files/RoaringSet.h"
+using namespace std;
+
+// Sorted distinct union (optimal.cpp)
+size_t unionArrays(const vector<int> &a, const vector<int> &b, int out[])
+{
+    size_t i = 0, j = 0, k = 0;
+    while (i < a.size() && j < b.size())
+    {
+        int x;
+        if (a[i] < b[j])
+            x = a[i++];
+        else if (b[j] < a[i])
+            x = b[j++];
+        else
+        {
+            x = a[i];
+            i++;
+            j++;
+        }
+        if (k == 0 || out[k - 1] != x)
+            out[k++] = x;
+    }
+    for (; i < a.size(); i++)
+        if (k == 0 || out[k - 1] != a[i])
+            out[k++] = a[i];
+    for (; j < b.size(); j++)
+        if (k == 0 || out[k - 1] != b[j])
+            out[k++] = b[j];
+    return k;
+}
+
+// Sorted intersection (Q8 optimal.cpp)
+size_t intersectArrays(const vector<int> &a, const vector<int> &b, int out[])
+{
+    size_t i = 0, j = 0, k = 0;
+    while (i < a.size() && j < b.size())
+    {
+        if (a[i] == b[j])
+        {
+            out[k++] = a[i];
+            i++;
+            j++;
+        }
+        else if (a[i] < b[j])
+            i++;
+        else
+            j++;
+    }
+    return k;
+}
+
+double msSince(chrono::high_resolution_clock::time_point t0)
+{
+    return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - t0).count();
+}
+
+bool sameAs(const RoaringSet &s, const int expected[], size_t n)
+{
+    if (s.cardinality() != n)
+        return false;
+    vector<int> got(n);
+    s.toSorted(got.data());
+    return equal(got.begin(), got.end(), expected);
+}
+
+void compare(const char *name, const vector<int> &a, const vector<int> &b)
+{
+    RoaringSet ra = RoaringSet::fromSorted(a.data(), a.size());
+    RoaringSet rb = RoaringSet::fromSorted(b.data(), b.size());
+    ra.runOptimize();
+    rb.runOptimize();
+
+    vector<int> out(a.size() + b.size());
+    RoaringSet::unionOf(ra, rb); // warm-up: the first run pays the page faults for fresh containers
+    RoaringSet::intersectionOf(ra, rb);
+
+    auto t0 = chrono::high_resolution_clock::now();
+    size_t u = unionArrays(a, b, out.data());
+    double arrayUnion = msSince(t0);
+
+    t0 = chrono::high_resolution_clock::now();
+    RoaringSet ru = RoaringSet::unionOf(ra, rb);
+    double bitmapUnion = msSince(t0);
+    bool ok = sameAs(ru, out.data(), u);
+
+    t0 = chrono::high_resolution_clock::now();
+    size_t in = intersectArrays(a, b, out.data());
+    double arrayIntersect = msSince(t0);
+
+    t0 = chrono::high_resolution_clock::now();
+    RoaringSet ri = RoaringSet::intersectionOf(ra, rb);
+    double bitmapIntersect = msSince(t0);
+    ok = ok && sameAs(ri, out.data(), in);
+
+    // Difference is checked against std::set_difference
+    size_t d = set_difference(a.begin(), a.end(), b.begin(), b.end(), out.begin()) - out.begin();
+    ok = ok && sameAs(RoaringSet::differenceOf(ra, rb), out.data(), d);
+
+    cout << "--- " << name << " (" << a.size() << " + " << b.size() << " values) ---" << endl;
+    cout << "size         : arrays " << (a.size() + b.size()) * sizeof(int) / 1024 << " KB, bitmaps "
+         << (ra.sizeInBytes() + rb.sizeInBytes()) / 1024 << " KB" << endl;
+    cout << "union        : arrays " << arrayUnion << " ms, bitmaps " << bitmapUnion << " ms" << endl;
+    cout << "intersection : arrays " << arrayIntersect << " ms, bitmaps " << bitmapIntersect << " ms" << endl;
+    cout << (ok ? "All results match" : "MISMATCH") << endl;
+}
+
+int main()
+{
+    // Small example (same arrays as optimal.cpp)
+    int arr1[] = {1, 2, 2, 3, 4, 4, 5, 6};
+    int arr2[] = {2, 3, 3, 4, 5, 5};
+    RoaringSet s1 = RoaringSet::fromSorted(arr1, sizeof(arr1) / sizeof(arr1[0]));
+    RoaringSet s2 = RoaringSet::fromSorted(arr2, sizeof(arr2) / sizeof(arr2[0]));
+
+    cout << "Union: ";
+    RoaringSet::unionOf(s1, s2).forEach([](int x)
+                                        { cout << x << " "; });
+    cout << endl;
+    cout << "Intersection: ";
+    RoaringSet::intersectionOf(s1, s2).forEach([](int x)
+                                               { cout << x << " "; });
+    cout << endl;
+
+    // Benchmarks over the value range [0, 2^26)
+    const int RANGE = 1 << 26;
+    mt19937 rng(45);
+
+    auto randomSet = [&](double density)
+    {
+        vector<int> v;
+        bernoulli_distribution keep(density);
+        for (int x = 0; x < RANGE; x++)
+            if (keep(rng))
+                v.push_back(x);
+        return v;
+    };
+
+    auto clusteredSet = [&]()
+    {
+        vector<int> v;
+        int x = 0;
+        while (true)
+        {
+            x += (int)(rng() % 4096);     // gap
+            int len = 1 + (int)(rng() % 8192); // consecutive stretch
+            if (x + len >= RANGE)
+                break;
+            for (int k = 0; k < len; k++)
+                v.push_back(x + k);
+            x += len;
+        }
+        return v;
+    };
+
+    compare("sparse, 1% density", randomSet(0.01), randomSet(0.01));
+    compare("dense, 50% density", randomSet(0.5), randomSet(0.5));
+    compare("clustered runs", clusteredSet(), clusteredSet());
+
+    return 0;
+}
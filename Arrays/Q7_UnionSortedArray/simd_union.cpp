@@ -0,0 +1,232 @@
+/*
+ * Union of Two Sorted Arrays - SIMD Bitonic Merge + SIMD Dedupe (AVX2)
+ *
+ * Problem: Same as optimal.cpp (sorted distinct union). On random sorted data
+ * the scalar `if (arr1[i] <= arr2[j])` loop mispredicts about half the time.
+ *
+ * Approach (8 elements per step):
+ * - Merge network: two sorted 8-int registers A and B are merged by reversing
+ *   B (A, reverse(B) is a bitonic sequence), taking lane-wise min/max (the
+ *   8 smallest and 8 largest, each still bitonic), and sorting each half with
+ *   three compare-exchange stages at distance 4, 2, 1. All in registers.
+ * - Stream: keep the upper 8 ("carry") in a register. Each step loads the
+ *   next 8 elements from whichever input has the smaller next value, merges
+ *   them with the carry, outputs the lower 8 and keeps the upper 8. The only
+ *   branch left is one choice per 8 elements.
+ * - Dedupe: the lower 8 are sorted, so a lane is new iff it differs from its
+ *   predecessor (the previous block's last lane for lane 0). The keep-mask
+ *   indexes the shared shuffle table (utility_files/CompactLUT.h) to pack the
+ *   distinct values, and the write pointer advances by popcount(mask).
+ * - Tail: when either input has fewer than 8 left, a scalar 3-way merge
+ *   finishes the carry and both remainders with the optimal.cpp duplicate check.
+ *
+ * Complexity:
+ * - Time: O(n1 + n2), one merge network per 8 output elements
+ * - Space: O(1) besides the output (out needs room for n1 + n2 values)
+ *
+ * Compile with: g++ -O2 -march=native simd_union.cpp
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#ifdef __AVX2__
+#include <immintrin.h>
+#include "../../utility_files/CompactLUT.h"
+#endif
+using namespace std;
+
+// Scalar two-pointer distinct union (optimal.cpp)
+size_t unionScalar(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    size_t i = 0, j = 0, k = 0;
+    while (i < n1 && j < n2)
+    {
+        int x;
+        if (a[i] < b[j])
+            x = a[i++];
+        else if (b[j] < a[i])
+            x = b[j++];
+        else
+        {
+            x = a[i];
+            i++;
+            j++;
+        }
+        if (k == 0 || out[k - 1] != x)
+            out[k++] = x;
+    }
+    for (; i < n1; i++)
+        if (k == 0 || out[k - 1] != a[i])
+            out[k++] = a[i];
+    for (; j < n2; j++)
+        if (k == 0 || out[k - 1] != b[j])
+            out[k++] = b[j];
+    return k;
+}
+
+#ifdef __AVX2__
+// Sort a bitonic 8-lane register: compare-exchange at distance 4, 2, 1
+static inline __m256i bitonicClean8(__m256i v)
+{
+    __m256i p = _mm256_permute2x128_si256(v, v, 0x01);
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), 0xF0);
+
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), 0xCC);
+
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), 0xAA);
+    return v;
+}
+
+// Merge two sorted registers: lo gets the 8 smallest, hi the 8 largest (both sorted)
+static inline void bitonicMerge8(__m256i a, __m256i b, __m256i &lo, __m256i &hi)
+{
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    __m256i rb = _mm256_permutevar8x32_epi32(b, reverse);
+    lo = bitonicClean8(_mm256_min_epi32(a, rb));
+    hi = bitonicClean8(_mm256_max_epi32(a, rb));
+}
+
+size_t unionAVX2(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    if (n1 < 8 || n2 < 8)
+        return unionScalar(a, n1, b, n2, out);
+
+    const __m256i rotate = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    const __m256i lane7 = _mm256_set1_epi32(7);
+
+    size_t i = 8, j = 8, w = 0;
+    __m256i lo, carry;
+    bitonicMerge8(_mm256_loadu_si256((const __m256i *)a),
+                  _mm256_loadu_si256((const __m256i *)b), lo, carry);
+
+    __m256i prevVec = lo;
+    bool first = true;
+
+    // Emit `lo` without duplicates, comparing each lane with its predecessor
+    auto emit = [&](__m256i v)
+    {
+        __m256i shifted = _mm256_permutevar8x32_epi32(v, rotate);
+        shifted = _mm256_blend_epi32(shifted, _mm256_permutevar8x32_epi32(prevVec, lane7), 0x01);
+        unsigned keep = ~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, shifted))) & 0xFF;
+        if (first)
+        {
+            keep |= 1; // nothing before the very first value
+            first = false;
+        }
+        __m256i perm = _mm256_load_si256((const __m256i *)compactLUT.perm[keep]);
+        _mm256_storeu_si256((__m256i *)(out + w), _mm256_permutevar8x32_epi32(v, perm));
+        w += __builtin_popcount(keep);
+        prevVec = v;
+    };
+
+    emit(lo);
+    while (i + 8 <= n1 && j + 8 <= n2)
+    {
+        __m256i next;
+        if (a[i] <= b[j])
+        {
+            next = _mm256_loadu_si256((const __m256i *)(a + i));
+            i += 8;
+        }
+        else
+        {
+            next = _mm256_loadu_si256((const __m256i *)(b + j));
+            j += 8;
+        }
+        bitonicMerge8(next, carry, lo, carry);
+        emit(lo);
+    }
+
+    // Scalar 3-way tail: carry (sorted, 8 values), a[i..n1), b[j..n2)
+    alignas(32) int rest[8];
+    _mm256_store_si256((__m256i *)rest, carry);
+    int last = _mm256_extract_epi32(prevVec, 7);
+    size_t c = 0;
+    while (c < 8 || i < n1 || j < n2)
+    {
+        int x;
+        int pick = -1;
+        if (c < 8)
+            pick = 0, x = rest[c];
+        if (i < n1 && (pick < 0 || a[i] < x))
+            pick = 1, x = a[i];
+        if (j < n2 && (pick < 0 || b[j] < x))
+            pick = 2, x = b[j];
+
+        if (pick == 0)
+            c++;
+        else if (pick == 1)
+            i++;
+        else
+            j++;
+
+        if (x != last)
+        {
+            out[w++] = x;
+            last = x;
+        }
+    }
+    return w;
+}
+#endif
+
+size_t sortedUnion(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+#ifdef __AVX2__
+    return unionAVX2(a, n1, b, n2, out);
+#else
+    return unionScalar(a, n1, b, n2, out);
+#endif
+}
+
+int main()
+{
+    // Sorted input arrays (optimal.cpp example, extended so the SIMD path runs)
+    int arr1[] = {1, 2, 2, 3, 4, 4, 5, 6, 8, 8, 9, 11, 12, 15, 15, 20};
+    int arr2[] = {2, 3, 3, 4, 5, 5, 7, 8, 10, 12, 13, 14, 16, 17, 18};
+    size_t n1 = sizeof(arr1) / sizeof(arr1[0]);
+    size_t n2 = sizeof(arr2) / sizeof(arr2[0]);
+
+    vector<int> unionArr(n1 + n2);
+    unionArr.resize(sortedUnion(arr1, n1, arr2, n2, unionArr.data()));
+    cout << "Union: ";
+    for (int x : unionArr)
+        cout << x << " ";
+    cout << endl;
+
+    // Benchmark on random sorted data (few duplicates, and then many)
+    const size_t N = 1 << 23;
+    int ranges[] = {INT32_MAX, (int)N};
+    for (int range : ranges)
+    {
+        vector<int> a(N), b(N);
+        mt19937 rng(33);
+        for (size_t k = 0; k < N; k++)
+        {
+            a[k] = (int)(rng() % (unsigned)range);
+            b[k] = (int)(rng() % (unsigned)range);
+        }
+        sort(a.begin(), a.end());
+        sort(b.begin(), b.end());
+
+        vector<int> expected(2 * N), out(2 * N);
+        auto t0 = chrono::high_resolution_clock::now();
+        size_t e = unionScalar(a.data(), N, b.data(), N, expected.data());
+        auto t1 = chrono::high_resolution_clock::now();
+        size_t c = sortedUnion(a.data(), N, b.data(), N, out.data());
+        auto t2 = chrono::high_resolution_clock::now();
+
+        bool ok = c == e && equal(out.begin(), out.begin() + c, expected.begin());
+        cout << "value range " << range << ": scalar " << chrono::duration<double, milli>(t1 - t0).count()
+             << " ms, SIMD " << chrono::duration<double, milli>(t2 - t1).count() << " ms"
+             << (ok ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * Intersection of Two Sorted Arrays (with duplicates) - Adaptive Galloping
+ *
+ * Problem: Same as optimal.cpp (each common value x appears min(count in A,
+ * count in B) times), but the two arrays can have very different sizes,
+ * e.g. 100 elements against 10^8. The two-pointer scan still walks the whole
+ * large array: O(n1 + n2).
+ *
+ * Approach (adaptive):
+ * - Sizes comparable (ratio below GALLOP_RATIO): use the linear merge from optimal.cpp.
+ * - Sizes skewed: walk the SMALL array one run of equal values at a time, and
+ *   find that value in the LARGE array by galloping from the current position:
+ *   probe j+1, j+2, j+4, j+8, ... until the probe is >= x, then binary search
+ *   inside the last step. The cost depends on how far we jump, not on n2.
+ * - Duplicates: the run of x in the small array has length cs. Galloping again
+ *   (for the first value > x) gives its run length cl in the large array.
+ *   Output min(cs, cl) copies, exactly like optimal.cpp consuming equal pairs one by one.
+ * - The large-array position only moves forward, so the searches never
+ *   re-scan anything.
+ *
+ * Complexity:
+ * - Time: O(m log(n / m)) for m = min(n1, n2), n = max(n1, n2); O(n1 + n2) in linear mode
+ * - Space: O(1) besides the output (out needs room for min(n1, n2) values)
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include "../../utility_files/Gallop.h"
+using namespace std;
+
+const size_t GALLOP_RATIO = 32;
+
+// Linear merge from optimal.cpp
+size_t intersectLinear(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    size_t i = 0, j = 0, k = 0;
+    while (i < n1 && j < n2)
+    {
+        if (a[i] == b[j])
+        {
+            out[k++] = a[i];
+            i++;
+            j++;
+        }
+        else if (a[i] < b[j])
+            i++;
+        else
+            j++;
+    }
+    return k;
+}
+
+// small must be the shorter array
+size_t intersectGallop(const int small[], size_t ns, const int large[], size_t nl, int out[])
+{
+    size_t i = 0, j = 0, k = 0;
+    while (i < ns && j < nl)
+    {
+        int x = small[i];
+
+        // Run of x in the small array (usually length 1, so scan linearly)
+        size_t runEnd = i + 1;
+        while (runEnd < ns && small[runEnd] == x)
+            runEnd++;
+
+        // Run of x in the large array
+        j = gallop(large, j, nl, x, false);
+        size_t largeEnd = gallop(large, j, nl, x, true);
+
+        size_t copies = min(runEnd - i, largeEnd - j);
+        for (size_t c = 0; c < copies; c++)
+            out[k++] = x;
+
+        i = runEnd;
+        j = largeEnd;
+    }
+    return k;
+}
+
+// Picks the strategy from the size ratio; output order matches optimal.cpp
+size_t intersectAdaptive(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    if (n1 > n2)
+    {
+        swap(a, b);
+        swap(n1, n2);
+    }
+    if (n1 == 0)
+        return 0;
+    if (n2 / n1 < GALLOP_RATIO)
+        return intersectLinear(a, n1, b, n2, out);
+    return intersectGallop(a, n1, b, n2, out);
+}
+
+int main()
+{
+    // Sorted input arrays (same as optimal.cpp)
+    int arr1[] = {1, 2, 2, 3, 4};
+    int arr2[] = {2, 2, 3, 5};
+    size_t n1 = sizeof(arr1) / sizeof(arr1[0]);
+    size_t n2 = sizeof(arr2) / sizeof(arr2[0]);
+
+    vector<int> ans(min(n1, n2));
+    ans.resize(intersectAdaptive(arr1, n1, arr2, n2, ans.data()));
+    cout << "Intersection: ";
+    for (int x : ans)
+        cout << x << " ";
+    cout << endl;
+
+    // Benchmark: one 10^8-element array against small arrays of growing size
+    const size_t LARGE = 100000000;
+    vector<int> large(LARGE);
+    mt19937 rng(43);
+    int v = 0;
+    for (size_t i = 0; i < LARGE; i++)
+    {
+        v += (int)(rng() % 4); // sorted, with duplicates (gap 0)
+        large[i] = v;
+    }
+
+    for (size_t ns : {100, 10000, 1000000, 10000000})
+    {
+        vector<int> small(ns);
+        for (size_t i = 0; i < ns; i++)
+            small[i] = (int)(rng() % (unsigned)v);
+        sort(small.begin(), small.end());
+
+        vector<int> expected(ns), out(ns);
+        auto t0 = chrono::high_resolution_clock::now();
+        size_t e = intersectLinear(small.data(), ns, large.data(), LARGE, expected.data());
+        auto t1 = chrono::high_resolution_clock::now();
+        size_t c = intersectAdaptive(small.data(), ns, large.data(), LARGE, out.data());
+        auto t2 = chrono::high_resolution_clock::now();
+
+        bool ok = c == e && equal(out.begin(), out.begin() + c, expected.begin());
+        cout << ns << " x " << LARGE << ": linear " << chrono::duration<double, milli>(t1 - t0).count()
+             << " ms, adaptive " << chrono::duration<double, milli>(t2 - t1).count() << " ms"
+             << (ok ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
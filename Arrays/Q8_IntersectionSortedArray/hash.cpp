@@ -0,0 +1,339 @@
+/*
+ * Intersection of Two Arrays (with duplicates) - Hash Counting (Unsorted Input)
+ *
+ * Problem: Same multiset semantics as brute.cpp / optimal.cpp (each common
+ * value x appears min(count in A, count in B) times), but the inputs are NOT
+ * sorted. brute.cpp handles that in O(n1 * n2) with a visited flag per
+ * element, which stops being usable around 10^5 elements, and sorting first
+ * costs O(n log n).
+ *
+ * Approach (build + probe):
+ * - BUILD on the smaller array: a flat open-addressing table (linear probing,
+ *   power-of-two capacity, at most 50% full) maps value -> remaining count.
+ * - PROBE with the larger array: if the value's count is > 0, output it and
+ *   decrement. The decrement gives exactly min(countA, countB) copies, the
+ *   job brute.cpp's visited[] flags did.
+ * - Parallel (partitioned hash join): both arrays are scattered into P
+ *   partitions by the top bits of the hash (count, prefix sum, scatter, like
+ *   utility_files/ParallelPartition.h). Equal values land in the same
+ *   partition, so the P build/probe jobs are independent, each with a small,
+ *   cache-resident table.
+ * - Output order follows the probing array (serial) or the partitions
+ *   (parallel). The multiset of values is the same.
+ *
+ * Complexity:
+ * - Time: O(n1 + n2) expected; parallel O((n1 + n2) / T) per thread
+ * - Space: O(min(n1, n2)) for the table; parallel adds O(n1 + n2) for partitions
+ */
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include "../../utility_files/ScratchArena.h"
+#include "../../utility_files/ThreadUtils.h"
+using namespace std;
+
+static inline uint64_t hashValue(int x)
+{
+    return (uint64_t)(uint32_t)x * 0x9E3779B97F4A7C15ull;
+}
+
+// value -> remaining count; slots use the hash bits just below the first `skipBits`
+class CountTable
+{
+private:
+    struct Slot
+    {
+        int key;
+        int count; // -1 = empty slot
+    };
+
+    vector<Slot> slots;
+    size_t mask;
+    int shift;
+    int skipBits;
+
+    size_t home(uint64_t h) const { return (size_t)((h << skipBits) >> shift); }
+
+public:
+    CountTable(size_t n, int skipBits = 0) : skipBits(skipBits)
+    {
+        int bits = 4;
+        while (((size_t)1 << bits) < 2 * n)
+            bits++;
+        slots.assign((size_t)1 << bits, {0, -1});
+        mask = slots.size() - 1;
+        shift = 64 - bits;
+    }
+
+    void add(int x)
+    {
+        for (size_t s = home(hashValue(x));; s = (s + 1) & mask)
+        {
+            if (slots[s].count < 0)
+            {
+                slots[s] = {x, 1};
+                return;
+            }
+            if (slots[s].key == x)
+            {
+                slots[s].count++;
+                return;
+            }
+        }
+    }
+
+    // Consume one copy of x if any is left
+    bool take(int x)
+    {
+        for (size_t s = home(hashValue(x));; s = (s + 1) & mask)
+        {
+            if (slots[s].count < 0)
+                return false;
+            if (slots[s].key == x)
+            {
+                if (slots[s].count == 0)
+                    return false;
+                slots[s].count--;
+                return true;
+            }
+        }
+    }
+};
+
+// out needs room for min(n1, n2) values
+size_t intersectHash(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    if (n1 > n2)
+    {
+        swap(a, b);
+        swap(n1, n2);
+    }
+    CountTable table(n1);
+    for (size_t i = 0; i < n1; i++)
+        table.add(a[i]);
+
+    size_t k = 0;
+    for (size_t j = 0; j < n2; j++)
+        if (table.take(b[j]))
+            out[k++] = b[j];
+    return k;
+}
+
+const int PARTITION_BITS = 8; // 256 partitions
+
+// Scatter arr into partitions by the top hash bits; start[p] .. start[p + 1] is partition p
+void scatterByHash(const int arr[], size_t n, int parts[], vector<size_t> &start, unsigned threads)
+{
+    const size_t P = (size_t)1 << PARTITION_BITS;
+    vector<vector<size_t>> count(threads, vector<size_t>(P, 0));
+    auto partOf = [](int x)
+    { return (size_t)(hashValue(x) >> (64 - PARTITION_BITS)); };
+
+    forEachChunk(n, threads, [&](unsigned t, size_t lo, size_t hi)
+                 {
+        for (size_t i = lo; i < hi; i++)
+            count[t][partOf(arr[i])]++; });
+
+    // Offsets: partition-major, then thread order inside a partition
+    start.assign(P + 1, 0);
+    size_t sum = 0;
+    for (size_t p = 0; p < P; p++)
+    {
+        start[p] = sum;
+        for (unsigned t = 0; t < threads; t++)
+        {
+            size_t c = count[t][p];
+            count[t][p] = sum;
+            sum += c;
+        }
+    }
+    start[P] = sum;
+
+    forEachChunk(n, threads, [&](unsigned t, size_t lo, size_t hi)
+                 {
+        vector<size_t> &pos = count[t];
+        for (size_t i = lo; i < hi; i++)
+            parts[pos[partOf(arr[i])]++] = arr[i]; });
+}
+
+size_t intersectHashParallel(const int a[], size_t n1, const int b[], size_t n2, int out[], unsigned threads)
+{
+    if (n1 > n2)
+    {
+        swap(a, b);
+        swap(n1, n2);
+    }
+    threads = max(1u, min<unsigned>(threads, (unsigned)(n2 / 65536 + 1)));
+    const size_t P = (size_t)1 << PARTITION_BITS;
+
+    ScratchScope scratch;
+    int *partA = scratch.alloc<int>(n1);
+    int *partB = scratch.alloc<int>(n2);
+    vector<size_t> startA, startB;
+    scatterByHash(a, n1, partA, startA, threads);
+    scatterByHash(b, n2, partB, startB, threads);
+
+    // Partition p writes at most |A_p| values, into out[startA[p], startA[p + 1])
+    vector<size_t> count(P);
+    runOnThreads(threads, [&](unsigned t)
+                 {
+        for (size_t p = t; p < P; p += threads)
+        {
+            CountTable table(startA[p + 1] - startA[p], PARTITION_BITS);
+            for (size_t i = startA[p]; i < startA[p + 1]; i++)
+                table.add(partA[i]);
+
+            size_t k = startA[p];
+            for (size_t j = startB[p]; j < startB[p + 1]; j++)
+                if (table.take(partB[j]))
+                    out[k++] = partB[j];
+            count[p] = k - startA[p];
+        } });
+
+    size_t total = 0;
+    for (size_t p = 0; p < P; p++)
+    {
+        memmove(out + total, out + startA[p], count[p] * sizeof(int));
+        total += count[p];
+    }
+    return total;
+}
+
+// Baseline: std::unordered_map counts
+size_t intersectUnorderedMap(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    if (n1 > n2)
+    {
+        swap(a, b);
+        swap(n1, n2);
+    }
+    unordered_map<int, int> freq;
+    for (size_t i = 0; i < n1; i++)
+        freq[a[i]]++;
+    size_t k = 0;
+    for (size_t j = 0; j < n2; j++)
+    {
+        auto it = freq.find(b[j]);
+        if (it != freq.end() && it->second > 0)
+        {
+            it->second--;
+            out[k++] = b[j];
+        }
+    }
+    return k;
+}
+
+// Baseline: sort copies, then optimal.cpp's two-pointer loop
+size_t intersectSortFirst(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    vector<int> x(a, a + n1), y(b, b + n2);
+    sort(x.begin(), x.end());
+    sort(y.begin(), y.end());
+    size_t i = 0, j = 0, k = 0;
+    while (i < n1 && j < n2)
+    {
+        if (x[i] == y[j])
+        {
+            out[k++] = x[i];
+            i++;
+            j++;
+        }
+        else if (x[i] < y[j])
+            i++;
+        else
+            j++;
+    }
+    return k;
+}
+
+// brute.cpp: visited flags, O(n1 * n2)
+size_t intersectBrute(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    vector<bool> visited(n2, false);
+    size_t k = 0;
+    for (size_t i = 0; i < n1; i++)
+        for (size_t j = 0; j < n2; j++)
+            if (a[i] == b[j] && !visited[j])
+            {
+                out[k++] = a[i];
+                visited[j] = true;
+                break;
+            }
+    return k;
+}
+
+int main()
+{
+    // Unsorted input arrays (brute.cpp's values, shuffled)
+    int arr1[] = {4, 2, 1, 3, 2};
+    int arr2[] = {5, 2, 3, 2};
+    size_t n1 = sizeof(arr1) / sizeof(arr1[0]);
+    size_t n2 = sizeof(arr2) / sizeof(arr2[0]);
+
+    vector<int> ans(min(n1, n2));
+    ans.resize(intersectHash(arr1, n1, arr2, n2, ans.data()));
+    cout << "Intersection: ";
+    for (int x : ans)
+        cout << x << " ";
+    cout << endl;
+
+    struct Engine
+    {
+        const char *name;
+        size_t (*fn)(const int *, size_t, const int *, size_t, int *);
+    };
+    unsigned threads = max(1u, thread::hardware_concurrency());
+
+    // Benchmark: unsorted arrays with many duplicates (values drawn from n2 / 4)
+    for (size_t n : {(size_t)20000, (size_t)1 << 23})
+    {
+        size_t na = n / 8, nb = n;
+        vector<int> a(na), b(nb);
+        mt19937 rng(47);
+        for (int &x : a)
+            x = (int)(rng() % (nb / 4));
+        for (int &x : b)
+            x = (int)(rng() % (nb / 4));
+
+        vector<int> expected(na);
+        expected.resize(intersectSortFirst(a.data(), na, b.data(), nb, expected.data()));
+
+        cout << "--- " << na << " x " << nb << " ---" << endl;
+        vector<Engine> engines = {{"sort + two pointers", intersectSortFirst},
+                                  {"unordered_map      ", intersectUnorderedMap},
+                                  {"flat hash table    ", intersectHash}};
+        if (n <= 20000)
+            engines.insert(engines.begin(), {"brute (visited)    ", intersectBrute});
+
+        auto report = [&](const char *name, double ms, vector<int> &out, size_t c)
+        {
+            out.resize(c);
+            sort(out.begin(), out.end());
+            cout << name << ": " << ms << " ms" << (out == expected ? "" : "  [MISMATCH]") << endl;
+        };
+
+        for (auto &e : engines)
+        {
+            vector<int> out(na);
+            auto t0 = chrono::high_resolution_clock::now();
+            size_t c = e.fn(a.data(), na, b.data(), nb, out.data());
+            auto t1 = chrono::high_resolution_clock::now();
+            report(e.name, chrono::duration<double, milli>(t1 - t0).count(), out, c);
+        }
+
+        vector<int> out(na);
+        intersectHashParallel(a.data(), na, b.data(), nb, out.data(), threads); // warm-up: grows the arena once
+        auto t0 = chrono::high_resolution_clock::now();
+        size_t c = intersectHashParallel(a.data(), na, b.data(), nb, out.data(), threads);
+        auto t1 = chrono::high_resolution_clock::now();
+        report("partitioned hash   ", chrono::duration<double, milli>(t1 - t0).count(), out, c);
+    }
+
+    return 0;
+}
@@ -0,0 +1,230 @@
+/*
+ * Intersection of Many Sorted Arrays - Smallest-First Galloping (N-ary)
+ *
+ * Problem: Generalizes optimal.cpp from 2 to m sorted arrays (3-20 posting
+ * lists). Each common value x appears min over all lists of count(x) times.
+ *
+ * Approach:
+ * - Order the lists by size. Candidates come from the SMALLEST list, since no
+ *   answer can be larger than it.
+ * - For each run of equal values x in the smallest list, gallop (the search
+ *   from galloping.cpp, shared via utility_files/Gallop.h) in the next list,
+ *   then the next, ... The larger lists are only touched near the
+ *   candidates, never scanned.
+ * - A miss in list k lands on list k's next value y > x. No candidate below y
+ *   can succeed, so the smallest list gallops straight to y. Fewer candidates
+ *   survive to reach the large lists.
+ * - Early exit: once any list runs out, nothing later can match, so stop.
+ * - Parallel: cut the smallest list into T chunks (at run boundaries so equal
+ *   values stay together). Each thread binary-searches its start in the other
+ *   lists and writes into out at its own chunk offset. The pieces are then
+ *   moved together.
+ *
+ * Complexity:
+ * - Time: O(n0 * sum over k of log(nk / n0)) in the worst case for smallest size n0
+ * - Space: O(m) cursors per thread (out needs room for the smallest list's size)
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include "../../utility_files/ThreadUtils.h"
+#include "../../utility_files/Gallop.h"
+using namespace std;
+
+struct List
+{
+    const int *data;
+    size_t size;
+};
+
+// Intersect lists[0][lo, hi) with all other lists (lists sorted by size); returns count written
+size_t intersectRange(const vector<List> &lists, size_t lo, size_t hi, int out[])
+{
+    const List &first = lists[0];
+    size_t m = lists.size();
+    if (lo >= hi)
+        return 0;
+
+    // Cursors start at the first value >= first.data[lo]
+    vector<size_t> cursor(m, 0);
+    for (size_t k = 1; k < m; k++)
+        cursor[k] = lower_bound(lists[k].data, lists[k].data + lists[k].size, first.data[lo]) - lists[k].data;
+
+    size_t count = 0, i = lo;
+    while (i < hi)
+    {
+        int x = first.data[i];
+        size_t runEnd = i + 1;
+        while (runEnd < hi && first.data[runEnd] == x)
+            runEnd++;
+
+        size_t copies = runEnd - i;
+        bool miss = false;
+        for (size_t k = 1; k < m; k++)
+        {
+            const List &l = lists[k];
+            cursor[k] = gallop(l.data, cursor[k], l.size, x, false);
+            if (cursor[k] == l.size)
+                return count; // early exit: list k is exhausted
+
+            if (l.data[cursor[k]] != x)
+            {
+                // Skip every candidate below list k's next value
+                i = gallop(first.data, runEnd, hi, l.data[cursor[k]], false);
+                miss = true;
+                break;
+            }
+            size_t end = gallop(l.data, cursor[k], l.size, x, true);
+            copies = min(copies, end - cursor[k]);
+            cursor[k] = end;
+        }
+        if (miss)
+            continue;
+
+        for (size_t c = 0; c < copies; c++)
+            out[count++] = x;
+        i = runEnd;
+    }
+    return count;
+}
+
+vector<List> smallestFirst(vector<List> lists)
+{
+    sort(lists.begin(), lists.end(), [](const List &a, const List &b)
+         { return a.size < b.size; });
+    return lists;
+}
+
+// out needs room for the smallest list's size
+size_t intersectMany(const vector<List> &input, int out[])
+{
+    if (input.empty())
+        return 0;
+    vector<List> lists = smallestFirst(input);
+    return intersectRange(lists, 0, lists[0].size, out);
+}
+
+size_t intersectManyParallel(const vector<List> &input, int out[], unsigned threads)
+{
+    if (input.empty())
+        return 0;
+    vector<List> lists = smallestFirst(input);
+    const List &first = lists[0];
+    threads = max(1u, min<unsigned>(threads, (unsigned)(first.size / 1024 + 1)));
+
+    // Chunk borders moved forward so a run of equal values is never split
+    vector<size_t> border(threads + 1);
+    for (unsigned t = 0; t <= threads; t++)
+    {
+        size_t b = first.size * t / threads;
+        while (b > 0 && b < first.size && first.data[b] == first.data[b - 1])
+            b++;
+        border[t] = max(b, t > 0 ? border[t - 1] : 0);
+    }
+
+    // Each thread writes into its own slice of out (its result never exceeds its chunk)
+    vector<size_t> count(threads);
+    runOnThreads(threads, [&](unsigned t)
+                 { count[t] = intersectRange(lists, border[t], border[t + 1], out + border[t]); });
+
+    size_t total = 0;
+    for (unsigned t = 0; t < threads; t++)
+    {
+        memmove(out + total, out + border[t], count[t] * sizeof(int));
+        total += count[t];
+    }
+    return total;
+}
+
+// Baseline: optimal.cpp applied pairwise, in the given order
+vector<int> pairwiseIntersect(const vector<List> &lists)
+{
+    vector<int> acc(lists[0].data, lists[0].data + lists[0].size);
+    for (size_t k = 1; k < lists.size(); k++)
+    {
+        const List &l = lists[k];
+        vector<int> next;
+        size_t i = 0, j = 0;
+        while (i < acc.size() && j < l.size)
+        {
+            if (acc[i] == l.data[j])
+            {
+                next.push_back(acc[i]);
+                i++;
+                j++;
+            }
+            else if (acc[i] < l.data[j])
+                i++;
+            else
+                j++;
+        }
+        acc = move(next);
+    }
+    return acc;
+}
+
+int main()
+{
+    // Small example: three sorted arrays with duplicates
+    vector<int> a = {1, 2, 2, 3, 4, 7, 7, 7};
+    vector<int> b = {2, 2, 3, 5, 7, 7};
+    vector<int> c = {0, 2, 2, 2, 7, 7, 7, 9};
+    vector<List> small = {{a.data(), a.size()}, {b.data(), b.size()}, {c.data(), c.size()}};
+    vector<int> ans(a.size());
+    ans.resize(intersectMany(small, ans.data()));
+    cout << "Intersection: ";
+    for (int x : ans)
+        cout << x << " ";
+    cout << endl;
+
+    // Benchmark: m posting lists with sizes from 10^5 to 10^7 sharing 1000 planted values
+    const int RANGE = 1 << 27;
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    mt19937 rng(46);
+
+    vector<int> planted(1000);
+    for (int &x : planted)
+        x = (int)(rng() % RANGE);
+
+    for (size_t m : {3, 8, 20})
+    {
+        vector<vector<int>> data(m);
+        for (size_t k = 0; k < m; k++)
+        {
+            // Geometric sizes, largest list first so the input order is the worst case
+            size_t n = (size_t)(1e7 * pow(1e-2, (double)k / (m - 1)));
+            data[k].resize(n);
+            for (int &x : data[k])
+                x = (int)(rng() % RANGE);
+            data[k].insert(data[k].end(), planted.begin(), planted.end());
+            sort(data[k].begin(), data[k].end());
+        }
+        vector<List> lists;
+        for (auto &d : data)
+            lists.push_back({d.data(), d.size()});
+        vector<int> out(data.back().size());
+
+        auto t0 = chrono::high_resolution_clock::now();
+        vector<int> expected = pairwiseIntersect(lists);
+        auto t1 = chrono::high_resolution_clock::now();
+        size_t serial = intersectMany(lists, out.data());
+        bool ok = serial == expected.size() && equal(expected.begin(), expected.end(), out.begin());
+        auto t2 = chrono::high_resolution_clock::now();
+        size_t parallel = intersectManyParallel(lists, out.data(), threads);
+        auto t3 = chrono::high_resolution_clock::now();
+        ok = ok && parallel == expected.size() && equal(expected.begin(), expected.end(), out.begin());
+
+        cout << m << " lists -> " << expected.size() << " common values" << endl;
+        cout << "  pairwise two-pointer : " << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+        cout << "  smallest-first gallop: " << chrono::duration<double, milli>(t2 - t1).count() << " ms" << endl;
+        cout << "  parallel (" << threads << " threads) : " << chrono::duration<double, milli>(t3 - t2).count() << " ms"
+             << (ok ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+/*
+ * Intersection of Two Sorted Arrays (with duplicates) - SIMD Block Compare (AVX2)
+ *
+ * Problem: Same as optimal.cpp (each common value x appears min(count in A,
+ * count in B) times). For similarly sized arrays the scalar loop is limited
+ * by its three-way branch, which is unpredictable at most selectivities.
+ *
+ * Approach (8x8 all-pairs block compare):
+ * - Load 8 values from each array (va, vb). Compare va against vb and against
+ *   its 7 rotations (3 in-lane shuffles, a 128-bit swap, and 3 more shuffles).
+ *   OR-ing the 8 compare masks marks every lane of va that occurs in vb.
+ * - The marked lanes are packed with utility_files/CompactLUT.h (as in Q3/Q6)
+ *   and stored; the output pointer advances by popcount(mask).
+ * - Advancing: if a[i+7] < b[j+7], the whole A block is done. In B, the scalar
+ *   loop would have stepped over every value <= a[i+7], so j moves by
+ *   popcount(vb <= a[i+7]). The symmetric rule applies when b[j+7] < a[i+7];
+ *   on a tie both blocks are done. The pointers therefore always sit exactly
+ *   where optimal.cpp's loop would, which is what keeps duplicates right.
+ * - Duplicates: the all-pairs compare is only exact when neither block repeats
+ *   a value. A block with two equal neighbours is handled by the scalar loop
+ *   until one pointer leaves its block (same state, so the next block resumes
+ *   normally). Duplicates across block borders need nothing special.
+ * - Tail: the scalar loop from optimal.cpp finishes the last < 8 elements.
+ *
+ * Complexity:
+ * - Time: O(n1 + n2), about one block compare per 8 elements consumed
+ * - Space: O(1) besides the output (out needs room for min(n1, n2) values)
+ *
+ * Compile with: g++ -O2 -march=native simd.cpp
+ */
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#ifdef __AVX2__
+#include <immintrin.h>
+#include "../../utility_files/CompactLUT.h"
+#endif
+using namespace std;
+
+// Scalar two-pointer loop from optimal.cpp, starting at (i, j) and stopping at (iEnd, jEnd)
+size_t intersectScalarFrom(const int a[], size_t &i, size_t iEnd, const int b[], size_t &j, size_t jEnd, int out[])
+{
+    size_t k = 0;
+    while (i < iEnd && j < jEnd)
+    {
+        if (a[i] == b[j])
+        {
+            out[k++] = a[i];
+            i++;
+            j++;
+        }
+        else if (a[i] < b[j])
+            i++;
+        else
+            j++;
+    }
+    return k;
+}
+
+size_t intersectScalar(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    size_t i = 0, j = 0;
+    return intersectScalarFrom(a, i, n1, b, j, n2, out);
+}
+
+#ifdef __AVX2__
+static inline unsigned laneMask(__m256i v)
+{
+    return (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(v));
+}
+
+// Lanes of va that occur anywhere in vb
+static inline __m256i matchAny8(__m256i va, __m256i vb)
+{
+    __m256i vbSwap = _mm256_permute2x128_si256(vb, vb, 0x01);
+    __m256i m = _mm256_cmpeq_epi32(va, vb);
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, vbSwap));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vbSwap, _MM_SHUFFLE(0, 3, 2, 1))));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vbSwap, _MM_SHUFFLE(1, 0, 3, 2))));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vbSwap, _MM_SHUFFLE(2, 1, 0, 3))));
+    return m;
+}
+
+// True if some lane equals its left neighbour (the block repeats a value)
+static inline bool hasRepeat(__m256i v)
+{
+    const __m256i prevLane = _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6);
+    __m256i eq = _mm256_cmpeq_epi32(v, _mm256_permutevar8x32_epi32(v, prevLane));
+    return (laneMask(eq) & 0xFE) != 0;
+}
+
+size_t intersectAVX2(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+    size_t i = 0, j = 0, k = 0;
+    while (i + 8 <= n1 && j + 8 <= n2)
+    {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(b + j));
+
+        if (hasRepeat(va) || hasRepeat(vb))
+        {
+            k += intersectScalarFrom(a, i, i + 8, b, j, j + 8, out + k);
+            continue;
+        }
+
+        unsigned match = laneMask(matchAny8(va, vb));
+        __m256i perm = _mm256_load_si256((const __m256i *)compactLUT.perm[match]);
+        _mm256_storeu_si256((__m256i *)(out + k), _mm256_permutevar8x32_epi32(va, perm));
+        k += __builtin_popcount(match);
+
+        int lastA = a[i + 7], lastB = b[j + 7];
+        if (lastA < lastB)
+        {
+            // j skips every B value <= lastA (the scalar loop's stopping point)
+            __m256i gt = _mm256_cmpgt_epi32(vb, _mm256_set1_epi32(lastA));
+            j += __builtin_ctz(laneMask(gt));
+            i += 8;
+        }
+        else if (lastB < lastA)
+        {
+            __m256i gt = _mm256_cmpgt_epi32(va, _mm256_set1_epi32(lastB));
+            i += __builtin_ctz(laneMask(gt));
+            j += 8;
+        }
+        else
+        {
+            i += 8;
+            j += 8;
+        }
+    }
+
+    return k + intersectScalarFrom(a, i, n1, b, j, n2, out + k);
+}
+#endif
+
+size_t sortedIntersection(const int a[], size_t n1, const int b[], size_t n2, int out[])
+{
+#ifdef __AVX2__
+    return intersectAVX2(a, n1, b, n2, out);
+#else
+    return intersectScalar(a, n1, b, n2, out);
+#endif
+}
+
+int main()
+{
+    // Sorted input arrays (same as optimal.cpp)
+    int arr1[] = {1, 2, 2, 3, 4};
+    int arr2[] = {2, 2, 3, 5};
+    size_t n1 = sizeof(arr1) / sizeof(arr1[0]);
+    size_t n2 = sizeof(arr2) / sizeof(arr2[0]);
+
+    vector<int> ans(min(n1, n2));
+    ans.resize(sortedIntersection(arr1, n1, arr2, n2, ans.data()));
+    cout << "Intersection: ";
+    for (int x : ans)
+        cout << x << " ";
+    cout << endl;
+
+    // Benchmark: two 2^22-element sets sharing a given fraction of their values
+    const size_t N = 1 << 22;
+    double selectivities[] = {0.001, 0.01, 0.1, 0.5, 1.0};
+    for (double s : selectivities)
+    {
+        size_t common = (size_t)(s * N);
+        mt19937 rng(44);
+
+        // 2N - common distinct values in random order
+        vector<int> pool(2 * N - common);
+        int v = 0;
+        for (auto &x : pool)
+        {
+            v += 1 + (int)(rng() % 8);
+            x = v;
+        }
+        shuffle(pool.begin(), pool.end(), rng);
+
+        vector<int> a(pool.begin(), pool.begin() + N);
+        vector<int> b(pool.begin(), pool.begin() + common);
+        b.insert(b.end(), pool.begin() + N, pool.end());
+        sort(a.begin(), a.end());
+        sort(b.begin(), b.end());
+
+        vector<int> expected(N), out(N);
+        auto t0 = chrono::high_resolution_clock::now();
+        size_t e = intersectScalar(a.data(), N, b.data(), N, expected.data());
+        auto t1 = chrono::high_resolution_clock::now();
+        size_t c = sortedIntersection(a.data(), N, b.data(), N, out.data());
+        auto t2 = chrono::high_resolution_clock::now();
+
+        bool ok = c == e && e == common && equal(out.begin(), out.begin() + c, expected.begin());
+        cout << "selectivity " << s * 100 << "%: scalar " << chrono::duration<double, milli>(t1 - t0).count()
+             << " ms, SIMD " << chrono::duration<double, milli>(t2 - t1).count() << " ms"
+             << (ok ? "" : "  [MISMATCH]") << endl;
+    }
+
+    return 0;
+}
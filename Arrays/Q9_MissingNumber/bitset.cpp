@@ -0,0 +1,241 @@
+/*
+ * Missing (and Duplicate) Numbers from 1..N - Bitset Presence + Word Scan
+ *
+ * Problem: Same as better.cpp (report ALL missing values in 1..N, ignoring
+ * values outside the range), plus every value that appears more than once.
+ * better.cpp spends a 4-byte int per possible value: 4 GB for an ID
+ * range of 10^9.
+ *
+ * Approach:
+ * - Presence: one bit per value (seen), 32x smaller than vector<int>. A second
+ *   bitset (dup) gets bit v when v is seen again: if bit v of seen is already
+ *   set, set bit v of dup.
+ * - Parallel fill, two options:
+ *   (a) shared bitsets updated with atomic fetch_or. The returned old word
+ *       tells whether the bit was already set, so exactly one thread
+ *       "sees v first" and any later one marks the duplicate.
+ *   (b) per-thread bitsets with plain stores, merged word by word afterwards:
+ *       dup |= dup_t | (seen & seen_t); seen |= seen_t. No atomics, but T
+ *       copies of the bitset.
+ * - Scan: a word at a time. ~seen[w] holds the missing values of that word;
+ *   each set bit is pulled out with ctz and cleared with bits &= bits - 1.
+ *   A fully present word (the common case in an audit) costs one compare.
+ *
+ * Complexity:
+ * - Time: O(n / T) fill + O(N / 64 + answers) scan
+ * - Space: 2 bits per value in the range (N / 4 bytes), T times that for (b)
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <numeric>
+#include "../../utility_files/ThreadUtils.h"
+using namespace std;
+
+class PresenceBitset
+{
+private:
+    uint64_t n;
+    vector<uint64_t> seen, dup; // bit v = value v (bit 0 unused)
+
+public:
+    explicit PresenceBitset(uint64_t n) : n(n), seen(n / 64 + 1, 0), dup(n / 64 + 1, 0) {}
+
+    bool inRange(uint64_t v) const { return v >= 1 && v <= n; }
+
+    void add(uint64_t v)
+    {
+        uint64_t bit = 1ull << (v & 63);
+        uint64_t &word = seen[v >> 6];
+        dup[v >> 6] |= word & bit;
+        word |= bit;
+    }
+
+    // Safe to call from several threads at once
+    void addAtomic(uint64_t v)
+    {
+        uint64_t bit = 1ull << (v & 63);
+        uint64_t old = __atomic_fetch_or(&seen[v >> 6], bit, __ATOMIC_RELAXED);
+        if (old & bit)
+            __atomic_fetch_or(&dup[v >> 6], bit, __ATOMIC_RELAXED);
+    }
+
+    // Fold per-thread bitsets into this one over words [lo, hi)
+    void mergeRange(const vector<PresenceBitset> &parts, size_t lo, size_t hi)
+    {
+        for (size_t w = lo; w < hi; w++)
+        {
+            uint64_t s = seen[w], d = dup[w];
+            for (const PresenceBitset &p : parts)
+            {
+                d |= p.dup[w] | (s & p.seen[w]);
+                s |= p.seen[w];
+            }
+            seen[w] = s;
+            dup[w] = d;
+        }
+    }
+
+    size_t words() const { return seen.size(); }
+
+    // f(v) for every value in 1..n that was never added, in increasing order
+    template <typename F>
+    void forEachMissing(F f) const
+    {
+        for (size_t w = 0; w < seen.size(); w++)
+        {
+            uint64_t bits = ~seen[w];
+            if (w == 0)
+                bits &= ~1ull; // 0 is not part of the range
+            if (w == seen.size() - 1)
+                bits &= (n % 64 == 63) ? ~0ull : ((1ull << (n % 64 + 1)) - 1); // drop bits above n
+            while (bits)
+            {
+                f((uint64_t)w * 64 + __builtin_ctzll(bits));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    // f(v) for every value added more than once
+    template <typename F>
+    void forEachDuplicate(F f) const
+    {
+        for (size_t w = 0; w < dup.size(); w++)
+            for (uint64_t bits = dup[w]; bits; bits &= bits - 1)
+                f((uint64_t)w * 64 + __builtin_ctzll(bits));
+    }
+};
+
+PresenceBitset buildSerial(const uint32_t arr[], size_t count, uint64_t n)
+{
+    PresenceBitset set(n);
+    for (size_t i = 0; i < count; i++)
+        if (set.inRange(arr[i]))
+            set.add(arr[i]);
+    return set;
+}
+
+PresenceBitset buildAtomic(const uint32_t arr[], size_t count, uint64_t n, unsigned threads)
+{
+    threads = max(1u, min<unsigned>(threads, (unsigned)(count / 65536 + 1)));
+    PresenceBitset set(n);
+    forEachChunk(count, threads, [&](unsigned, size_t lo, size_t hi)
+                 {
+        for (size_t i = lo; i < hi; i++)
+            if (set.inRange(arr[i]))
+                set.addAtomic(arr[i]); });
+    return set;
+}
+
+PresenceBitset buildPerThread(const uint32_t arr[], size_t count, uint64_t n, unsigned threads)
+{
+    // One bitset per chunk, so parts must match the chunk count forEachChunk will use
+    threads = max(1u, min<unsigned>(threads, (unsigned)(count / 65536 + 1)));
+    vector<PresenceBitset> parts(threads, PresenceBitset(n));
+    forEachChunk(count, threads, [&](unsigned t, size_t lo, size_t hi)
+                 {
+        PresenceBitset &mine = parts[t];
+        for (size_t i = lo; i < hi; i++)
+            if (mine.inRange(arr[i]))
+                mine.add(arr[i]); });
+
+    PresenceBitset set(n);
+    forEachChunk(set.words(), threads, [&](unsigned, size_t lo, size_t hi)
+                 { set.mergeRange(parts, lo, hi); });
+    return set;
+}
+
+// better.cpp's presence array, counting so duplicates show up too
+void auditWithIntArray(const uint32_t arr[], size_t count, uint64_t n, vector<uint64_t> &missing, vector<uint64_t> &dups)
+{
+    vector<int> hash(n + 1, 0);
+    for (size_t i = 0; i < count; i++)
+        if (arr[i] >= 1 && arr[i] <= n)
+            hash[arr[i]]++;
+    for (uint64_t v = 1; v <= n; v++)
+    {
+        if (hash[v] == 0)
+            missing.push_back(v);
+        else if (hash[v] > 1)
+            dups.push_back(v);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // Small example (better.cpp's input plus a repeated 4)
+    uint32_t arr[] = {1, 2, 4, 5, 4};
+    PresenceBitset small = buildSerial(arr, 5, 6);
+    cout << "Missing Number(s): ";
+    small.forEachMissing([](uint64_t v)
+                         { cout << v << " "; });
+    cout << endl
+         << "Duplicate Number(s): ";
+    small.forEachDuplicate([](uint64_t v)
+                           { cout << v << " "; });
+    cout << endl;
+
+    // Audit benchmark: IDs 1..N, scrambled inside 1M-ID windows (roughly ordered,
+    // like an ID log), with some IDs replaced by repeats
+    uint64_t N = argc > 1 ? strtoull(argv[1], nullptr, 10) : 250000000ull;
+    if (N < 2 || N > UINT32_MAX)
+    {
+        cerr << "N must be in [2, " << UINT32_MAX << "]" << endl;
+        return 1;
+    }
+    vector<uint32_t> ids(N);
+    const uint64_t WINDOW = 1 << 20;
+    for (uint64_t base = 0; base < N; base += WINDOW)
+    {
+        // i * stride mod len visits every offset once when gcd(stride, len) = 1
+        uint64_t len = min(WINDOW, N - base), stride = 2654435761ull % len | 1;
+        while (gcd(stride, len) != 1)
+            stride += 2;
+        for (uint64_t i = 0; i < len; i++)
+            ids[base + i] = (uint32_t)(base + 1 + (i * stride) % len);
+    }
+    for (uint64_t i = 7; i < N; i += N / 1000 + 1)
+        ids[i] = ids[i / 2]; // the overwritten ID goes missing, ids[i / 2] is repeated
+
+    vector<uint64_t> expectedMissing, expectedDups;
+    auto t0 = chrono::high_resolution_clock::now();
+    auditWithIntArray(ids.data(), N, N, expectedMissing, expectedDups);
+    auto t1 = chrono::high_resolution_clock::now();
+    cout << "N = " << N << ": " << expectedMissing.size() << " missing, " << expectedDups.size() << " duplicated" << endl;
+    cout << "vector<int> hash (" << (N + 1) * sizeof(int) / (1 << 20) << " MB): "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+
+    auto audit = [&](const string &name, auto build)
+    {
+        auto s0 = chrono::high_resolution_clock::now();
+        PresenceBitset set = build();
+        auto s1 = chrono::high_resolution_clock::now();
+        vector<uint64_t> missing, dups;
+        set.forEachMissing([&](uint64_t v)
+                           { missing.push_back(v); });
+        set.forEachDuplicate([&](uint64_t v)
+                             { dups.push_back(v); });
+        auto s2 = chrono::high_resolution_clock::now();
+
+        bool ok = missing == expectedMissing && dups == expectedDups;
+        cout << name << ": fill " << chrono::duration<double, milli>(s1 - s0).count() << " ms, scan "
+             << chrono::duration<double, milli>(s2 - s1).count() << " ms" << (ok ? "" : "  [MISMATCH]") << endl;
+    };
+
+    cout << "bitsets use " << 2 * (N / 64 + 1) * sizeof(uint64_t) / (1 << 20) << " MB" << endl;
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    audit("bitset, serial          ", [&]
+          { return buildSerial(ids.data(), N, N); });
+    audit("bitset, atomic OR       ", [&]
+          { return buildAtomic(ids.data(), N, N, threads); });
+    audit("bitset, per-thread merge", [&]
+          { return buildPerThread(ids.data(), N, N, threads); });
+
+    return 0;
+}
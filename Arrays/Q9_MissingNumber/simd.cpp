@@ -0,0 +1,276 @@
+/*
+ * Missing Number (1..N) - 64-bit Safe SIMD Sum/XOR + Multi-threaded Reduction
+ *
+ * Problem: Same as brute.cpp / optimal.cpp (values 1..N, exactly one
+ * missing), but N goes up to ~4 * 10^9. brute.cpp's `n * (n + 1) / 2` in int
+ * overflows once N passes ~65k, and at this size the input lives in a file.
+ *
+ * Approach:
+ * - Values are stored as uint32 (enough for N < 2^32). The expected totals
+ *   are computed in 64 bits: sum(1..N) by halving the even factor first, and
+ *   XOR(1..N) by the N % 4 pattern instead of a loop.
+ * - The sum uses unsigned 64-bit math, so even a wrap-around would cancel
+ *   out. missing = expected - actual is exact because the answer fits.
+ * - AVX2 kernel: 16 values per iteration. The XOR uses two 8 x 32-bit
+ *   accumulators. For the sum, each 32-bit lane is widened to 64 bits
+ *   (cvtepu32 -> epi64) into four 4 x 64-bit accumulators, so no partial sum
+ *   can overflow.
+ * - Both reductions come out of the same single pass. Their answers must
+ *   agree, which also catches inputs that break the "exactly one missing" rule.
+ * - Threads: each thread reduces one contiguous chunk and the partial
+ *   {sum, xor} results are combined (sum adds, xor xors).
+ * - Input: a binary file of uint32 values mapped with mmap, so the kernels
+ *   read the page cache directly without copying into a buffer.
+ *
+ * Usage:
+ *   ./simd [N]   (writes 1..N with one value missing to /tmp, maps it, runs, deletes it)
+ *   The default N = 5 * 10^8 (2 GB) fits small machines; N = 4000000000
+ *   needs a 16 GB file and enough RAM for page cache to avoid re-reading disk.
+ *
+ * Complexity:
+ * - Time: O(N / T) per thread, memory-bandwidth bound
+ * - Space: O(1) besides the mapped input
+ *
+ * Compile with: g++ -O2 -march=native -pthread simd.cpp
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "../../utility_files/ThreadUtils.h"
+using namespace std;
+
+struct Reduction
+{
+    uint64_t sum;
+    uint32_t xr;
+};
+
+// 1 + 2 + ... + n without overflowing the intermediate product
+uint64_t sumUpTo(uint64_t n)
+{
+    return n % 2 == 0 ? (n / 2) * (n + 1) : n * ((n + 1) / 2);
+}
+
+// 1 ^ 2 ^ ... ^ n, repeating with period 4
+uint64_t xorUpTo(uint64_t n)
+{
+    switch (n % 4)
+    {
+    case 0:
+        return n;
+    case 1:
+        return 1;
+    case 2:
+        return n + 1;
+    default:
+        return 0;
+    }
+}
+
+Reduction reduceScalar(const uint32_t a[], size_t n)
+{
+    Reduction r = {0, 0};
+    for (size_t i = 0; i < n; i++)
+    {
+        r.sum += a[i];
+        r.xr ^= a[i];
+    }
+    return r;
+}
+
+#ifdef __AVX2__
+static inline uint64_t horizontalSum(__m256i v)
+{
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256((__m256i *)lanes, v);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+Reduction reduceAVX2(const uint32_t a[], size_t n)
+{
+    __m256i x0 = _mm256_setzero_si256(), x1 = _mm256_setzero_si256();
+    __m256i s0 = _mm256_setzero_si256(), s1 = _mm256_setzero_si256();
+    __m256i s2 = _mm256_setzero_si256(), s3 = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(a + i));
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(a + i + 8));
+        x0 = _mm256_xor_si256(x0, v0);
+        x1 = _mm256_xor_si256(x1, v1);
+
+        // Widen each 32-bit lane to 64 bits before adding
+        s0 = _mm256_add_epi64(s0, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v0)));
+        s1 = _mm256_add_epi64(s1, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v0, 1)));
+        s2 = _mm256_add_epi64(s2, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v1)));
+        s3 = _mm256_add_epi64(s3, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v1, 1)));
+    }
+
+    alignas(32) uint32_t lanes[8];
+    _mm256_store_si256((__m256i *)lanes, _mm256_xor_si256(x0, x1));
+    Reduction r = reduceScalar(a + i, n - i);
+    for (uint32_t lane : lanes)
+        r.xr ^= lane;
+    r.sum += horizontalSum(_mm256_add_epi64(_mm256_add_epi64(s0, s1), _mm256_add_epi64(s2, s3)));
+    return r;
+}
+#endif
+
+Reduction reduce(const uint32_t a[], size_t n)
+{
+#ifdef __AVX2__
+    return reduceAVX2(a, n);
+#else
+    return reduceScalar(a, n);
+#endif
+}
+
+Reduction reduceParallel(const uint32_t a[], size_t n, unsigned threads)
+{
+    threads = max(1u, min<unsigned>(threads, (unsigned)(n / 65536 + 1)));
+    vector<Reduction> partial(threads);
+    forEachChunk(n, threads, [&](unsigned t, size_t lo, size_t hi)
+                 { partial[t] = reduce(a + lo, hi - lo); });
+
+    Reduction r = {0, 0};
+    for (const Reduction &p : partial)
+    {
+        r.sum += p.sum;
+        r.xr ^= p.xr;
+    }
+    return r;
+}
+
+// Writes 1..n except `missing` as uint32 values
+bool writeInput(const char *path, uint64_t n, uint64_t missing)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        return false;
+    vector<uint32_t> buf(1 << 20);
+    size_t used = 0;
+    for (uint64_t v = 1; v <= n; v++)
+    {
+        if (v == missing)
+            continue;
+        buf[used++] = (uint32_t)v;
+        if (used == buf.size())
+        {
+            if (fwrite(buf.data(), sizeof(uint32_t), used, f) != used)
+            {
+                int err = errno; // keep the write error for the caller's perror
+                fclose(f);
+                errno = err;
+                return false;
+            }
+            used = 0;
+        }
+    }
+    bool ok = fwrite(buf.data(), sizeof(uint32_t), used, f) == used && !ferror(f);
+    int err = errno;
+    if (fclose(f) != 0)
+        return false;
+    errno = err;
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    // Small example (same as optimal.cpp)
+    uint32_t arr[] = {1, 2, 4, 5};
+    Reduction small = reduce(arr, 4);
+    cout << "Missing number is: " << sumUpTo(5) - small.sum << endl;
+
+    uint64_t N = argc > 1 ? strtoull(argv[1], nullptr, 10) : 500000000ull;
+    if (N < 2 || N > UINT32_MAX)
+    {
+        cerr << "N must be in [2, " << UINT32_MAX << "]" << endl;
+        return 1;
+    }
+    uint64_t missing = N / 3 + 7 <= N ? N / 3 + 7 : 1;
+
+    const char *path = "/tmp/missing_number_input.bin";
+    cout << "Writing " << (N - 1) * sizeof(uint32_t) / 1e9 << " GB input to " << path << " ..." << endl;
+    if (!writeInput(path, N, missing))
+    {
+        perror(path);
+        return 1;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        perror(path);
+        unlink(path);
+        return 1;
+    }
+    size_t count = N - 1;
+
+    // Mapping past the end of a short file would SIGBUS on first touch
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size != count * sizeof(uint32_t))
+    {
+        cerr << path << ": unexpected size" << endl;
+        close(fd);
+        unlink(path);
+        return 1;
+    }
+    const uint32_t *data = (const uint32_t *)mmap(nullptr, count * sizeof(uint32_t), PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+    {
+        perror("mmap");
+        close(fd);
+        unlink(path);
+        return 1;
+    }
+    madvise((void *)data, count * sizeof(uint32_t), MADV_SEQUENTIAL);
+
+    auto run = [&](const string &name, auto kernel)
+    {
+        auto t0 = chrono::high_resolution_clock::now();
+        Reduction r = kernel();
+        auto t1 = chrono::high_resolution_clock::now();
+        double sec = chrono::duration<double>(t1 - t0).count();
+        uint64_t bySum = sumUpTo(N) - r.sum;
+        uint64_t byXor = xorUpTo(N) ^ r.xr;
+        bool ok = bySum == missing && byXor == missing;
+        cout << name << ": " << sec * 1e3 << " ms, " << count * sizeof(uint32_t) / 1e9 / sec << " GB/s"
+             << (ok ? "" : "  [WRONG]") << endl;
+    };
+
+    cout << "N = " << N << ", missing = " << missing << endl;
+    run("scalar (first touch)", [&]
+        { return reduceScalar(data, count); });
+    run("scalar              ", [&]
+        { return reduceScalar(data, count); });
+    run("SIMD                ", [&]
+        { return reduce(data, count); });
+
+    unsigned maxThreads = max(1u, thread::hardware_concurrency());
+    vector<unsigned> counts;
+    for (unsigned t = 1; t < maxThreads; t *= 2)
+        counts.push_back(t);
+    counts.push_back(maxThreads);
+    for (unsigned t : counts)
+        run("SIMD, " + to_string(t) + " thread(s)  ", [&]
+            { return reduceParallel(data, count, t); });
+
+    munmap((void *)data, count * sizeof(uint32_t));
+    close(fd);
+    unlink(path);
+    return 0;
+}
@@ -0,0 +1,221 @@
+/*
+ * Two Missing Numbers / Missing + Duplicate (1..N) - O(1) Memory
+ *
+ * Problem: optimal.cpp handles exactly one missing value. Here:
+ * (a) values 1..N with exactly TWO missing (N - 2 elements, distinct), or
+ * (b) N elements where one value of 1..N is missing and one is repeated.
+ * better.cpp would solve both with an O(N) presence array; these kernels
+ * keep O(1) memory for huge ranges.
+ *
+ * Approach 1 (XOR bit-partitioning):
+ * - XOR of 1..N and of all elements leaves x ^ y (the two unknowns; for (b)
+ *   they are the missing and the repeated value, since the repeat appears
+ *   twice in the array and once in 1..N).
+ * - x != y, so x ^ y has a set bit. Its lowest set bit splits every number
+ *   into two groups with x and y on different sides. XOR-ing each group
+ *   separately (over 1..N and over the elements) isolates x and y.
+ * - For (b) one more pass decides which of the two occurs in the array (the
+ *   repeated one).
+ *
+ * Approach 2 (sum and sum of squares):
+ * - (a) s = x + y and q = x^2 + y^2 from the differences to the closed forms,
+ *   then (x - y)^2 = 2q - s^2.
+ * - (b) d = missing - repeated and q = missing^2 - repeated^2, so
+ *   missing + repeated = q / d.
+ * - Sums of squares reach ~N^3 / 3, about 2 * 10^28 for N = 4 * 10^9, so the
+ *   accumulators are (unsigned) __int128. Values are at most 32 bits, so one
+ *   square always fits in 64 bits before it is added.
+ *
+ * Complexity:
+ * - Time: O(N) (XOR: two passes over the input; sums: one)
+ * - Space: O(1)
+ */
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+using namespace std;
+
+typedef unsigned __int128 u128;
+typedef __int128 i128;
+
+struct Pair
+{
+    uint64_t first, second;
+};
+
+uint64_t xorUpTo(uint64_t n)
+{
+    switch (n % 4)
+    {
+    case 0:
+        return n;
+    case 1:
+        return 1;
+    case 2:
+        return n + 1;
+    default:
+        return 0;
+    }
+}
+
+u128 sumUpTo(uint64_t n)
+{
+    return (u128)n * (n + 1) / 2;
+}
+
+u128 squaresUpTo(uint64_t n)
+{
+    return (u128)n * (n + 1) * (2 * (u128)n + 1) / 6;
+}
+
+// Both unknowns of "1..n XOR elements", split by the lowest differing bit
+Pair splitByXor(const uint32_t arr[], size_t count, uint64_t n)
+{
+    uint64_t both = xorUpTo(n);
+    for (size_t i = 0; i < count; i++)
+        both ^= arr[i];
+
+    uint64_t bit = both & (~both + 1); // lowest set bit
+    uint64_t x = 0;
+    for (uint64_t v = 1; v <= n; v++)
+        if (v & bit)
+            x ^= v;
+    for (size_t i = 0; i < count; i++)
+        if (arr[i] & bit)
+            x ^= arr[i];
+    return {x, both ^ x};
+}
+
+// (a) Two missing values, smaller first; count = n - 2
+Pair twoMissingXor(const uint32_t arr[], size_t count, uint64_t n)
+{
+    Pair p = splitByXor(arr, count, n);
+    return {min(p.first, p.second), max(p.first, p.second)};
+}
+
+// (b) {missing, repeated}; count = n
+Pair missingAndRepeatedXor(const uint32_t arr[], size_t count, uint64_t n)
+{
+    Pair p = splitByXor(arr, count, n);
+    for (size_t i = 0; i < count; i++)
+        if (arr[i] == p.first)
+            return {p.second, p.first};
+    return p;
+}
+
+// floor(sqrt(v)) for v < 2^64, corrected after the floating-point estimate
+uint64_t isqrt(uint64_t v)
+{
+    uint64_t r = (uint64_t)sqrtl((long double)v);
+    while (r > 0 && (u128)r * r > v)
+        r--;
+    while ((u128)(r + 1) * (r + 1) <= v)
+        r++;
+    return r;
+}
+
+Pair twoMissingSums(const uint32_t arr[], size_t count, uint64_t n)
+{
+    u128 sum = 0, squares = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t v = arr[i];
+        sum += v;
+        squares += v * v;
+    }
+    uint64_t s = (uint64_t)(sumUpTo(n) - sum); // x + y
+    u128 q = squaresUpTo(n) - squares;         // x^2 + y^2
+
+    // (y - x)^2 = 2q - s^2 <= n^2 fits in 64 bits
+    uint64_t diff = isqrt((uint64_t)(2 * q - (u128)s * s));
+    return {(s - diff) / 2, (s + diff) / 2};
+}
+
+Pair missingAndRepeatedSums(const uint32_t arr[], size_t count, uint64_t n)
+{
+    i128 sum = 0, squares = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t v = arr[i];
+        sum += v;
+        squares += v * v;
+    }
+    i128 d = (i128)sumUpTo(n) - sum;         // missing - repeated
+    i128 q = (i128)squaresUpTo(n) - squares; // missing^2 - repeated^2
+    i128 total = q / d;                      // missing + repeated
+    return {(uint64_t)((total + d) / 2), (uint64_t)((total - d) / 2)};
+}
+
+int main()
+{
+    // (a) 1..7 with 3 and 6 missing
+    uint32_t arr1[] = {1, 2, 4, 5, 7};
+    Pair a = twoMissingXor(arr1, 5, 7);
+    Pair a2 = twoMissingSums(arr1, 5, 7);
+    cout << "Missing numbers are: " << a.first << " " << a.second
+         << " (sums: " << a2.first << " " << a2.second << ")" << endl;
+
+    // (b) 1..6 with 3 missing and 5 repeated
+    uint32_t arr2[] = {1, 2, 5, 4, 5, 6};
+    Pair b = missingAndRepeatedXor(arr2, 6, 6);
+    Pair b2 = missingAndRepeatedSums(arr2, 6, 6);
+    cout << "Missing: " << b.first << ", repeated: " << b.second
+         << " (sums: " << b2.first << ", " << b2.second << ")" << endl;
+
+    // Benchmark: N = 10^8 against better.cpp's presence array
+    const uint64_t N = 100000000;
+    const uint64_t X = 12345678, Y = 87654321;
+
+    vector<uint32_t> twoGone, repeated;
+    twoGone.reserve(N - 2);
+    repeated.reserve(N);
+    for (uint64_t v = 1; v <= N; v++)
+    {
+        if (v != X && v != Y)
+            twoGone.push_back((uint32_t)v);
+        repeated.push_back((uint32_t)(v == X ? Y : v)); // X missing, Y twice
+    }
+
+    auto time = [](const char *name, auto kernel, Pair expected)
+    {
+        auto t0 = chrono::high_resolution_clock::now();
+        Pair p = kernel();
+        auto t1 = chrono::high_resolution_clock::now();
+        bool ok = p.first == expected.first && p.second == expected.second;
+        cout << name << ": " << chrono::duration<double, milli>(t1 - t0).count() << " ms"
+             << (ok ? "" : "  [WRONG]") << endl;
+    };
+
+    cout << "--- two missing, N = " << N << " ---" << endl;
+    time("XOR partition      ", [&]
+         { return twoMissingXor(twoGone.data(), twoGone.size(), N); }, {X, Y});
+    time("sum + squares      ", [&]
+         { return twoMissingSums(twoGone.data(), twoGone.size(), N); }, {X, Y});
+    time("presence (O(N) mem)", [&]
+         {
+        vector<int> hash(N + 1, 0);
+        for (uint32_t v : twoGone)
+            hash[v] = 1;
+        vector<uint64_t> gone;
+        for (uint64_t v = 1; v <= N; v++)
+            if (hash[v] == 0)
+                gone.push_back(v);
+        return Pair{gone[0], gone[1]}; }, {X, Y});
+
+    cout << "--- missing + repeated, N = " << N << " ---" << endl;
+    time("XOR partition      ", [&]
+         { return missingAndRepeatedXor(repeated.data(), repeated.size(), N); }, {X, Y});
+    time("sum + squares      ", [&]
+         { return missingAndRepeatedSums(repeated.data(), repeated.size(), N); }, {X, Y});
+
+    // 128-bit accumulators at the top of the uint32 range (closed forms only, no input)
+    uint64_t big = 4000000000ull;
+    cout << "sum of squares 1.." << big << " needs " << (int)(log2l((long double)squaresUpTo(big)) + 1)
+         << " bits" << endl;
+
+    return 0;
+}
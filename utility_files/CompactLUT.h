@@ -0,0 +1,31 @@
+#ifndef COMPACT_LUT_H
+#define COMPACT_LUT_H
+
+#include <cstdint>
+using namespace std;
+
+// Shuffle table for AVX2 stream compaction, shared by the Q3/Q6/Q7/Q8 SIMD
+// kernels. compactLUT.perm[mask] lists the lanes whose mask bit is set, packed
+// to the front: load it as a __m256i and pass it to _mm256_permutevar8x32_epi32,
+// then advance the output by popcount(mask). 256 x 8 x 4 bytes = 8 KB.
+struct CompactLUT
+{
+    alignas(32) uint32_t perm[256][8];
+
+    CompactLUT()
+    {
+        for (int mask = 0; mask < 256; mask++)
+        {
+            int k = 0;
+            for (int lane = 0; lane < 8; lane++)
+                if (mask & (1 << lane))
+                    perm[mask][k++] = lane;
+            while (k < 8)
+                perm[mask][k++] = 0; // don't-care lanes
+        }
+    }
+};
+
+static const CompactLUT compactLUT;
+
+#endif
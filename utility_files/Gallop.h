@@ -0,0 +1,42 @@
+#ifndef GALLOP_H
+#define GALLOP_H
+
+#include <cstddef>
+#include <algorithm>
+using namespace std;
+
+// Exponential ("galloping") search in a sorted array, shared by Q8
+// galloping.cpp and multiway.cpp. Cost is O(log distance) from `from`, not O(log n).
+
+// First index in [from, n) with arr[index] >= x (or > x if strict), by galloping from `from`
+inline size_t gallop(const int arr[], size_t from, size_t n, int x, bool strict)
+{
+    auto before = [&](size_t idx)
+    { return strict ? arr[idx] <= x : arr[idx] < x; };
+
+    if (from >= n || !before(from))
+        return from;
+
+    // Grow the step until arr[from + step] is no longer before x
+    size_t lo = from, step = 1;
+    while (lo + step < n && before(lo + step))
+    {
+        lo += step;
+        step *= 2;
+    }
+    size_t hi = min(lo + step, n);
+
+    // Binary search in (lo, hi]: arr[lo] is before x, arr[hi] (if any) is not
+    lo++;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (before(mid))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+#endif
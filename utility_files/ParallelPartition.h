@@ -0,0 +1,135 @@
+#ifndef PARALLEL_PARTITION_H
+#define PARALLEL_PARTITION_H
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include "ScratchArena.h"
+#include "ThreadUtils.h"
+using namespace std;
+
+// Stable partition helpers: elements with pred(x) == true go first, both
+// groups keep their original relative order. Used by Q6 (move zeros) and
+// Q18 (rearrange by sign).
+
+// Out-of-place: count per chunk, exclusive scan, parallel scatter.
+// Returns how many elements satisfy pred (they are out[0 .. result)).
+template <typename T, typename Pred>
+size_t parallelStablePartitionCopy(const T in[], size_t n, T out[], Pred pred, unsigned threads)
+{
+    threads = max(1u, min<unsigned>(threads, (unsigned)(n / 4096 + 1)));
+    vector<size_t> trueCount(threads), trueOffset(threads), falseOffset(threads);
+
+    // PASS 1: count matching elements in each chunk
+    forEachChunk(n, threads, [&](unsigned t, size_t lo, size_t hi)
+                 {
+        size_t c = 0;
+        for (size_t i = lo; i < hi; i++)
+            c += pred(in[i]) ? 1 : 0;
+        trueCount[t] = c; });
+
+    // Exclusive scan: trues fill [0, totalTrue), falses fill [totalTrue, n)
+    size_t per = (n + threads - 1) / threads;
+    size_t totalTrue = 0;
+    for (unsigned t = 0; t < threads; t++)
+    {
+        trueOffset[t] = totalTrue;
+        totalTrue += trueCount[t];
+    }
+    for (unsigned t = 0; t < threads; t++)
+    {
+        size_t lo = min(n, t * per);
+        falseOffset[t] = totalTrue + (lo - trueOffset[t]); // falses before this chunk
+    }
+
+    // PASS 2: each chunk scatters into its own disjoint output slots
+    forEachChunk(n, threads, [&](unsigned t, size_t lo, size_t hi)
+                 {
+        size_t wt = trueOffset[t], wf = falseOffset[t];
+        for (size_t i = lo; i < hi; i++)
+        {
+            if (pred(in[i]))
+                out[wt++] = in[i];
+            else
+                out[wf++] = in[i];
+        } });
+
+    return totalTrue;
+}
+
+// Stable partition of arr[lo, hi); scratch must hold hi - lo elements. Returns the split point
+template <typename T, typename Pred>
+size_t stablePartitionBlock(T arr[], size_t lo, size_t hi, Pred pred, T scratch[])
+{
+    size_t w = lo, f = 0;
+    for (size_t i = lo; i < hi; i++)
+    {
+        if (pred(arr[i]))
+            arr[w++] = arr[i];
+        else
+            scratch[f++] = arr[i];
+    }
+    copy(scratch, scratch + f, arr + w);
+    return w;
+}
+
+// In-place with bounded scratch:
+// 1) Cut [0, n) into blocks of at most `blockSize` elements and stable-partition
+//    each block -> T F T F ... The T block buffers are carved from the caller's
+//    ScratchArena, so repeated calls from one thread reuse the same memory.
+// 2) Merge neighbouring blocks pairwise: [T1 F1 T2 F2] becomes [T1 T2 F1 F2]
+//    by rotating the middle [F1 T2]. Pairs are independent, so each of the
+//    log2(blocks) rounds runs in parallel.
+// Returns how many elements satisfy pred.
+template <typename T, typename Pred>
+size_t parallelStablePartitionInPlace(T arr[], size_t n, Pred pred, unsigned threads,
+                                      size_t blockSize = 64 * 1024)
+{
+    if (n == 0)
+        return 0;
+    size_t blocks = (n + blockSize - 1) / blockSize;
+    threads = max(1u, min<unsigned>(threads, (unsigned)blocks));
+
+    // Each block remembers [begin, split, end); after a merge round the merged
+    // group is described by the entries of its first block
+    vector<size_t> begin(blocks), split(blocks), end(blocks);
+    for (size_t b = 0; b < blocks; b++)
+    {
+        begin[b] = b * blockSize;
+        end[b] = min(n, begin[b] + blockSize);
+    }
+
+    // PHASE 1: partition blocks (thread t takes blocks t, t+T, t+2T, ...)
+    // Workers are fresh threads with empty arenas, so all T buffers come from the caller's
+    size_t slice = min(blockSize, n);
+    ScratchScope scope;
+    T *buffers = scope.alloc<T>(threads * slice);
+    runOnThreads(threads, [&](unsigned t)
+                 {
+        T *scratch = buffers + t * slice;
+        for (size_t b = t; b < blocks; b += threads)
+            split[b] = stablePartitionBlock(arr, begin[b], end[b], pred, scratch); });
+
+    // PHASE 2: pairwise merge rounds
+    for (size_t width = 1; width < blocks; width *= 2)
+    {
+        size_t pairs = (blocks + 2 * width - 1) / (2 * width);
+        unsigned workers = (unsigned)min<size_t>(threads, pairs);
+        runOnThreads(workers, [&](unsigned t)
+                     {
+            for (size_t p = t; p < pairs; p += workers)
+            {
+                size_t a = p * 2 * width, b = a + width;
+                if (b >= blocks)
+                    continue;
+                // [T_a F_a T_b F_b] -> [T_a T_b F_a F_b]
+                size_t newSplit = split[a] + (split[b] - begin[b]);
+                rotate(arr + split[a], arr + begin[b], arr + split[b]);
+                split[a] = newSplit;
+                end[a] = end[b];
+            } });
+    }
+    return split[0];
+}
+
+#endif
@@ -0,0 +1,509 @@
+#ifndef ROARING_SET_H
+#define ROARING_SET_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+using namespace std;
+
+// Compressed set of int values in the style of Roaring bitmaps.
+// A value is split into a 16-bit key (high half) and a 16-bit low half; each
+// key that has members owns one container holding the low halves:
+// - ARRAY : sorted uint16 values, used while the chunk has <= 4096 members
+// - BITMAP: 65536 bits (8 KB), used above 4096 members
+// - RUN   : sorted [start, start + length] intervals, only after runOptimize()
+// Set semantics: duplicates in the input collapse to one member.
+// Used by Q7 (union) and Q8 (intersection) for dense integer sets.
+class RoaringSet
+{
+private:
+    static const uint32_t ARRAY_MAX = 4096;
+    static const size_t WORDS = 1024; // 65536 bits
+
+    struct Run
+    {
+        uint16_t start;
+        uint16_t length; // the run covers start .. start + length
+    };
+
+    enum Type : uint8_t
+    {
+        ARRAY,
+        BITMAP,
+        RUN
+    };
+
+    struct Container
+    {
+        Type type = ARRAY;
+        uint32_t card = 0;
+        vector<uint16_t> values; // ARRAY
+        vector<uint64_t> words;  // BITMAP
+        vector<Run> runs;        // RUN
+    };
+
+    vector<uint16_t> keys;
+    vector<Container> containers;
+
+    // Flipping the sign bit keeps int order when values are compared as unsigned
+    static uint32_t encode(int x) { return (uint32_t)x ^ 0x80000000u; }
+    static int decode(uint32_t u) { return (int)(u ^ 0x80000000u); }
+
+    static size_t payloadBytes(const Container &c)
+    {
+        if (c.type == ARRAY)
+            return c.values.size() * sizeof(uint16_t);
+        if (c.type == BITMAP)
+            return WORDS * sizeof(uint64_t);
+        return c.runs.size() * sizeof(Run);
+    }
+
+    static bool containsLow(const Container &c, uint16_t low)
+    {
+        if (c.type == ARRAY)
+            return binary_search(c.values.begin(), c.values.end(), low);
+        if (c.type == BITMAP)
+            return (c.words[low >> 6] >> (low & 63)) & 1;
+        auto it = upper_bound(c.runs.begin(), c.runs.end(), low, [](uint16_t v, const Run &r)
+                              { return v < r.start; });
+        if (it == c.runs.begin())
+            return false;
+        --it;
+        return low - it->start <= it->length;
+    }
+
+    static void setRange(vector<uint64_t> &words, uint32_t lo, uint32_t hi) // [lo, hi]
+    {
+        for (uint32_t w = lo >> 6; w <= hi >> 6; w++)
+        {
+            uint32_t from = max(lo, w << 6) & 63, to = min(hi, (w << 6) | 63) & 63;
+            uint64_t bits = (to - from == 63) ? ~0ull : (((1ull << (to - from + 1)) - 1) << from);
+            words[w] |= bits;
+        }
+    }
+
+    static vector<uint64_t> toWords(const Container &c)
+    {
+        if (c.type == BITMAP)
+            return c.words;
+        vector<uint64_t> words(WORDS, 0);
+        if (c.type == ARRAY)
+            for (uint16_t v : c.values)
+                words[v >> 6] |= 1ull << (v & 63);
+        else
+            for (const Run &r : c.runs)
+                setRange(words, r.start, (uint32_t)r.start + r.length);
+        return words;
+    }
+
+    // Calls f(low) for every member of the container in increasing order
+    template <typename F>
+    static void forEachLow(const Container &c, F f)
+    {
+        if (c.type == ARRAY)
+        {
+            for (uint16_t v : c.values)
+                f(v);
+        }
+        else if (c.type == BITMAP)
+        {
+            for (size_t w = 0; w < WORDS; w++)
+            {
+                uint64_t bits = c.words[w];
+                while (bits)
+                {
+                    f((uint16_t)(w * 64 + __builtin_ctzll(bits)));
+                    bits &= bits - 1;
+                }
+            }
+        }
+        else
+        {
+            for (const Run &r : c.runs)
+                for (uint32_t v = r.start; v <= (uint32_t)r.start + r.length; v++)
+                    f((uint16_t)v);
+        }
+    }
+
+    // Normalizing constructors: pick ARRAY or BITMAP by cardinality
+    static Container makeArray(vector<uint16_t> values)
+    {
+        Container c;
+        c.card = (uint32_t)values.size();
+        if (c.card <= ARRAY_MAX)
+        {
+            c.type = ARRAY;
+            c.values = move(values);
+            return c;
+        }
+        c.type = BITMAP;
+        c.words.assign(WORDS, 0);
+        for (uint16_t v : values)
+            c.words[v >> 6] |= 1ull << (v & 63);
+        return c;
+    }
+
+    static Container makeBitmap(vector<uint64_t> words)
+    {
+        Container c;
+        for (uint64_t w : words)
+            c.card += __builtin_popcountll(w);
+        if (c.card > ARRAY_MAX)
+        {
+            c.type = BITMAP;
+            c.words = move(words);
+            return c;
+        }
+        c.type = ARRAY;
+        c.values.reserve(c.card);
+        for (size_t w = 0; w < WORDS; w++)
+            for (uint64_t bits = words[w]; bits; bits &= bits - 1)
+                c.values.push_back((uint16_t)(w * 64 + __builtin_ctzll(bits)));
+        return c;
+    }
+
+    static Container makeRuns(vector<Run> runs)
+    {
+        Container c;
+        c.type = RUN;
+        for (const Run &r : runs)
+            c.card += (uint32_t)r.length + 1;
+        c.runs = move(runs);
+        shrink(c);
+        return c;
+    }
+
+    static size_t countRuns(const Container &c)
+    {
+        if (c.type == RUN)
+            return c.runs.size();
+        size_t runs = 0;
+        if (c.type == ARRAY)
+        {
+            for (size_t i = 0; i < c.values.size(); i++)
+                runs += i == 0 || c.values[i] != c.values[i - 1] + 1;
+            return runs;
+        }
+        // A run starts at every set bit whose lower neighbour is clear
+        uint64_t carry = 0;
+        for (uint64_t w : c.words)
+        {
+            runs += __builtin_popcountll(w & ~((w << 1) | carry));
+            carry = w >> 63;
+        }
+        return runs;
+    }
+
+    // Switch to whichever of the three layouts is smallest
+    static void shrink(Container &c)
+    {
+        size_t runBytes = countRuns(c) * sizeof(Run);
+        size_t flatBytes = c.card <= ARRAY_MAX ? c.card * sizeof(uint16_t) : WORDS * sizeof(uint64_t);
+        if (runBytes < flatBytes && c.type != RUN)
+        {
+            vector<Run> runs;
+            forEachLow(c, [&](uint16_t v)
+                       {
+                if (!runs.empty() && (uint32_t)runs.back().start + runs.back().length + 1 == v)
+                    runs.back().length++;
+                else
+                    runs.push_back({v, 0}); });
+            c.values.clear();
+            c.words.clear();
+            c.runs = move(runs);
+            c.type = RUN;
+        }
+        else if (runBytes >= flatBytes && c.type == RUN)
+        {
+            Container flat = c.card <= ARRAY_MAX ? makeArray(toValues(c)) : makeBitmap(toWords(c));
+            c = move(flat);
+        }
+    }
+
+    static vector<uint16_t> toValues(const Container &c)
+    {
+        if (c.type == ARRAY)
+            return c.values;
+        vector<uint16_t> values;
+        values.reserve(c.card);
+        forEachLow(c, [&](uint16_t v)
+                   { values.push_back(v); });
+        return values;
+    }
+
+    static Container unionOf(const Container &a, const Container &b)
+    {
+        if (a.type == RUN && b.type == RUN)
+        {
+            // Merge the interval lists, joining overlapping or touching runs
+            vector<Run> runs;
+            size_t i = 0, j = 0;
+            while (i < a.runs.size() || j < b.runs.size())
+            {
+                bool takeA = j == b.runs.size() || (i < a.runs.size() && a.runs[i].start <= b.runs[j].start);
+                const Run &r = takeA ? a.runs[i++] : b.runs[j++];
+                uint32_t end = (uint32_t)r.start + r.length;
+                if (!runs.empty() && r.start <= (uint32_t)runs.back().start + runs.back().length + 1)
+                {
+                    uint32_t backEnd = (uint32_t)runs.back().start + runs.back().length;
+                    runs.back().length = (uint16_t)(max(backEnd, end) - runs.back().start);
+                }
+                else
+                    runs.push_back(r);
+            }
+            return makeRuns(move(runs));
+        }
+        if (a.type == ARRAY && b.type == ARRAY)
+        {
+            vector<uint16_t> values(a.values.size() + b.values.size());
+            values.resize(set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                                    values.begin()) -
+                          values.begin());
+            return makeArray(move(values));
+        }
+
+        // Any BITMAP or mixed case: OR into a bitmap
+        const Container &big = a.type == BITMAP ? a : b;
+        const Container &other = &big == &a ? b : a;
+        vector<uint64_t> words = toWords(big);
+        if (other.type == BITMAP)
+            for (size_t w = 0; w < WORDS; w++)
+                words[w] |= other.words[w];
+        else if (other.type == ARRAY)
+            for (uint16_t v : other.values)
+                words[v >> 6] |= 1ull << (v & 63);
+        else
+            for (const Run &r : other.runs)
+                setRange(words, r.start, (uint32_t)r.start + r.length);
+        return makeBitmap(move(words));
+    }
+
+    static Container intersectionOf(const Container &a, const Container &b)
+    {
+        if (a.type == RUN && b.type == RUN)
+        {
+            vector<Run> runs;
+            size_t i = 0, j = 0;
+            while (i < a.runs.size() && j < b.runs.size())
+            {
+                uint32_t aEnd = (uint32_t)a.runs[i].start + a.runs[i].length;
+                uint32_t bEnd = (uint32_t)b.runs[j].start + b.runs[j].length;
+                uint32_t lo = max(a.runs[i].start, b.runs[j].start), hi = min(aEnd, bEnd);
+                if (lo <= hi)
+                    runs.push_back({(uint16_t)lo, (uint16_t)(hi - lo)});
+                if (aEnd < bEnd)
+                    i++;
+                else
+                    j++;
+            }
+            return makeRuns(move(runs));
+        }
+        if (a.type == ARRAY && b.type == ARRAY)
+        {
+            vector<uint16_t> values(min(a.values.size(), b.values.size()));
+            values.resize(set_intersection(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                                           values.begin()) -
+                          values.begin());
+            return makeArray(move(values));
+        }
+        if (a.type == ARRAY || b.type == ARRAY)
+        {
+            // Keep the array members that the other container has
+            const Container &arr = a.type == ARRAY ? a : b;
+            const Container &other = &arr == &a ? b : a;
+            vector<uint16_t> values;
+            for (uint16_t v : arr.values)
+                if (containsLow(other, v))
+                    values.push_back(v);
+            return makeArray(move(values));
+        }
+
+        vector<uint64_t> words = toWords(a);
+        vector<uint64_t> otherWords = b.type == BITMAP ? vector<uint64_t>() : toWords(b);
+        const uint64_t *bw = b.type == BITMAP ? b.words.data() : otherWords.data();
+        for (size_t w = 0; w < WORDS; w++)
+            words[w] &= bw[w];
+        return makeBitmap(move(words));
+    }
+
+    static Container differenceOf(const Container &a, const Container &b)
+    {
+        if (a.type == ARRAY)
+        {
+            vector<uint16_t> values;
+            for (uint16_t v : a.values)
+                if (!containsLow(b, v))
+                    values.push_back(v);
+            return makeArray(move(values));
+        }
+
+        vector<uint64_t> words = toWords(a);
+        if (b.type == ARRAY)
+            for (uint16_t v : b.values)
+                words[v >> 6] &= ~(1ull << (v & 63));
+        else
+        {
+            vector<uint64_t> otherWords = b.type == BITMAP ? vector<uint64_t>() : toWords(b);
+            const uint64_t *bw = b.type == BITMAP ? b.words.data() : otherWords.data();
+            for (size_t w = 0; w < WORDS; w++)
+                words[w] &= ~bw[w];
+        }
+        return makeBitmap(move(words));
+    }
+
+public:
+    RoaringSet() = default;
+
+    // Build from a sorted int array (duplicates allowed)
+    static RoaringSet fromSorted(const int arr[], size_t n)
+    {
+        RoaringSet s;
+        size_t i = 0;
+        while (i < n)
+        {
+            uint16_t key = (uint16_t)(encode(arr[i]) >> 16);
+            vector<uint16_t> values;
+            for (; i < n && (uint16_t)(encode(arr[i]) >> 16) == key; i++)
+            {
+                uint16_t low = (uint16_t)encode(arr[i]);
+                if (values.empty() || values.back() != low)
+                    values.push_back(low);
+            }
+            s.keys.push_back(key);
+            s.containers.push_back(makeArray(move(values)));
+        }
+        return s;
+    }
+
+    // Write the members in increasing order; out needs room for cardinality() values
+    size_t toSorted(int out[]) const
+    {
+        size_t k = 0;
+        forEach([&](int x)
+                { out[k++] = x; });
+        return k;
+    }
+
+    // Calls f(x) for every member in increasing order
+    template <typename F>
+    void forEach(F f) const
+    {
+        for (size_t c = 0; c < keys.size(); c++)
+        {
+            uint32_t high = (uint32_t)keys[c] << 16;
+            forEachLow(containers[c], [&](uint16_t low)
+                       { f(decode(high | low)); });
+        }
+    }
+
+    bool contains(int x) const
+    {
+        uint32_t u = encode(x);
+        auto it = lower_bound(keys.begin(), keys.end(), (uint16_t)(u >> 16));
+        if (it == keys.end() || *it != (uint16_t)(u >> 16))
+            return false;
+        return containsLow(containers[it - keys.begin()], (uint16_t)u);
+    }
+
+    size_t cardinality() const
+    {
+        size_t total = 0;
+        for (const Container &c : containers)
+            total += c.card;
+        return total;
+    }
+
+    // Convert containers to runs wherever that is smaller (long consecutive stretches)
+    void runOptimize()
+    {
+        for (Container &c : containers)
+            shrink(c);
+    }
+
+    // Approximate serialized size: per container a key, type and count, plus its payload
+    size_t sizeInBytes() const
+    {
+        size_t bytes = 0;
+        for (const Container &c : containers)
+            bytes += sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint32_t) + payloadBytes(c);
+        return bytes;
+    }
+
+    static RoaringSet unionOf(const RoaringSet &a, const RoaringSet &b)
+    {
+        RoaringSet r;
+        size_t i = 0, j = 0;
+        while (i < a.keys.size() || j < b.keys.size())
+        {
+            if (j == b.keys.size() || (i < a.keys.size() && a.keys[i] < b.keys[j]))
+            {
+                r.keys.push_back(a.keys[i]);
+                r.containers.push_back(a.containers[i++]);
+            }
+            else if (i == a.keys.size() || b.keys[j] < a.keys[i])
+            {
+                r.keys.push_back(b.keys[j]);
+                r.containers.push_back(b.containers[j++]);
+            }
+            else
+            {
+                r.keys.push_back(a.keys[i]);
+                r.containers.push_back(unionOf(a.containers[i++], b.containers[j++]));
+            }
+        }
+        return r;
+    }
+
+    static RoaringSet intersectionOf(const RoaringSet &a, const RoaringSet &b)
+    {
+        RoaringSet r;
+        size_t i = 0, j = 0;
+        while (i < a.keys.size() && j < b.keys.size())
+        {
+            if (a.keys[i] < b.keys[j])
+                i++;
+            else if (b.keys[j] < a.keys[i])
+                j++;
+            else
+            {
+                Container c = intersectionOf(a.containers[i], b.containers[j]);
+                if (c.card > 0)
+                {
+                    r.keys.push_back(a.keys[i]);
+                    r.containers.push_back(move(c));
+                }
+                i++;
+                j++;
+            }
+        }
+        return r;
+    }
+
+    // Members of a that are not in b
+    static RoaringSet differenceOf(const RoaringSet &a, const RoaringSet &b)
+    {
+        RoaringSet r;
+        size_t j = 0;
+        for (size_t i = 0; i < a.keys.size(); i++)
+        {
+            while (j < b.keys.size() && b.keys[j] < a.keys[i])
+                j++;
+            if (j == b.keys.size() || b.keys[j] != a.keys[i])
+            {
+                r.keys.push_back(a.keys[i]);
+                r.containers.push_back(a.containers[i]);
+                continue;
+            }
+            Container c = differenceOf(a.containers[i], b.containers[j]);
+            if (c.card > 0)
+            {
+                r.keys.push_back(a.keys[i]);
+                r.containers.push_back(move(c));
+            }
+        }
+        return r;
+    }
+};
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef SCRATCH_ARENA_H
+#define SCRATCH_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+using namespace std;
+
+// Thread-local bump allocator for short-lived temporary buffers.
+// alloc() just moves a pointer forward; release()/reset() hand everything back.
+// Once the arena has grown to fit the largest call, it does no more heap work.
+class ScratchArena
+{
+private:
+    struct Block
+    {
+        char *data;
+        size_t capacity;
+    };
+
+    vector<Block> blocks; // blocks[current] is the one being bumped
+    size_t current = 0;
+    size_t offset = 0;
+
+    static const size_t MIN_BLOCK = 64 * 1024;
+
+    void addBlock(size_t bytes)
+    {
+        size_t capacity = MIN_BLOCK;
+        if (!blocks.empty())
+            capacity = blocks.back().capacity * 2;
+        while (capacity < bytes)
+            capacity *= 2;
+        blocks.push_back({(char *)::operator new(capacity), capacity}); // throws bad_alloc
+    }
+
+    // Replace several blocks with one big enough for all of them
+    void consolidate()
+    {
+        size_t total = 0;
+        for (Block &b : blocks)
+        {
+            total += b.capacity;
+            ::operator delete(b.data);
+        }
+        blocks.clear();
+        blocks.push_back({(char *)::operator new(total), total});
+    }
+
+public:
+    // Position inside the arena, used to free everything allocated after it
+    struct Marker
+    {
+        size_t block;
+        size_t offset;
+    };
+
+    ScratchArena() = default;
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena &operator=(const ScratchArena &) = delete;
+
+    ~ScratchArena()
+    {
+        for (Block &b : blocks)
+            ::operator delete(b.data);
+    }
+
+    // One arena per thread, so no locking is needed
+    static ScratchArena &local()
+    {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+    // Uninitialized space for n objects of type T (trivial types only)
+    template <typename T>
+    T *alloc(size_t n)
+    {
+        size_t bytes = n * sizeof(T);
+        size_t align = alignof(T) < 16 ? 16 : alignof(T);
+
+        while (true)
+        {
+            if (current < blocks.size())
+            {
+                // Align the address itself: blocks are only guaranteed 16-byte aligned
+                uintptr_t base = (uintptr_t)blocks[current].data;
+                size_t start = (size_t)(((base + offset + align - 1) & ~(uintptr_t)(align - 1)) - base);
+                if (start + bytes <= blocks[current].capacity)
+                {
+                    offset = start + bytes;
+                    return (T *)(blocks[current].data + start);
+                }
+                if (current + 1 < blocks.size())
+                {
+                    current++;
+                    offset = 0;
+                    continue;
+                }
+            }
+            addBlock(bytes + align);
+            current = blocks.size() - 1;
+            offset = 0;
+        }
+    }
+
+    Marker mark() const
+    {
+        return {current, offset};
+    }
+
+    void release(Marker m)
+    {
+        current = m.block;
+        offset = m.offset;
+    }
+
+    // Free everything; if the arena had to grow, merge into one block for next time
+    void reset()
+    {
+        if (blocks.size() > 1)
+            consolidate();
+        current = 0;
+        offset = 0;
+    }
+
+    size_t capacity() const
+    {
+        size_t total = 0;
+        for (const Block &b : blocks)
+            total += b.capacity;
+        return total;
+    }
+};
+
+// Releases all scratch allocations made inside a scope when it ends
+class ScratchScope
+{
+private:
+    ScratchArena &arena;
+    ScratchArena::Marker marker;
+
+public:
+    explicit ScratchScope(ScratchArena &arena = ScratchArena::local())
+        : arena(arena), marker(arena.mark()) {}
+
+    ~ScratchScope()
+    {
+        if (marker.block == 0 && marker.offset == 0)
+            arena.reset();
+        else
+            arena.release(marker);
+    }
+
+    template <typename T>
+    T *alloc(size_t n)
+    {
+        return arena.alloc<T>(n);
+    }
+};
+
+#endif
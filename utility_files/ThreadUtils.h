@@ -0,0 +1,36 @@
+#ifndef THREAD_UTILS_H
+#define THREAD_UTILS_H
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstddef>
+using namespace std;
+
+// Fork/join helpers shared by the parallel solutions: start T threads, wait for all.
+
+// Runs body(t) on threads t = 0 .. threads-1 and waits for all of them
+template <typename Body>
+void runOnThreads(unsigned threads, Body body)
+{
+    vector<thread> pool;
+    for (unsigned t = 0; t < threads; t++)
+        pool.emplace_back([t, &body]()
+                          { body(t); });
+    for (auto &th : pool)
+        th.join();
+}
+
+// Runs body(t, lo, hi) for T equal chunks of [0, n) on T threads (T clamped to [1, n])
+template <typename Body>
+void forEachChunk(size_t n, unsigned threads, Body body)
+{
+    threads = (unsigned)max<size_t>(1, min<size_t>(threads, n));
+    size_t per = (n + threads - 1) / threads;
+    runOnThreads(threads, [&](unsigned t)
+                 {
+        size_t lo = min(n, t * per), hi = min(n, lo + per);
+        body(t, lo, hi); });
+}
+
+#endif